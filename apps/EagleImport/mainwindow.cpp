@@ -1,8 +1,8 @@
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
-#include <parseagle/library.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/pkg/footprint.h>
@@ -11,11 +11,6 @@
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/eagleimport/converterdb.h>
-#include <librepcb/eagleimport/symbolconverter.h>
-#include <librepcb/eagleimport/packageconverter.h>
-#include <librepcb/eagleimport/devicesetconverter.h>
-#include <librepcb/eagleimport/deviceconverter.h>
-#include "polygonsimplifier.h"
 
 namespace librepcb {
 using namespace library;
@@ -24,6 +19,8 @@ MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent), ui(new Ui::MainWindow)
 {
     ui->setupUi(this);
+    connect(&mConverterWatcher, &QFutureWatcher<void>::finished,
+            this, &MainWindow::conversionFinished);
 
     QSettings s;
     restoreGeometry(s.value("mainwindow/geometry").toByteArray());
@@ -39,6 +36,10 @@ MainWindow::MainWindow(QWidget *parent) :
 
 MainWindow::~MainWindow()
 {
+    // the worker thread accesses the converter, so wait until it has finished
+    if (mConverter) mConverter->abort();
+    mConverterWatcher.waitForFinished();
+
     QStringList inputList;
     for (int i = 0; i < ui->input->count(); i++)
         inputList.append(ui->input->item(i)->text());
@@ -57,10 +58,6 @@ MainWindow::~MainWindow()
 
 void MainWindow::reset()
 {
-    mAbortConversion = false;
-    mReadedElementsCount = 0;
-    mConvertedElementsCount = 0;
-
     ui->errors->clear();
     ui->pbarElements->setValue(0);
     ui->pbarElements->setMaximum(0);
@@ -74,8 +71,10 @@ void MainWindow::addError(const QString& msg, const FilePath& inputFile, int inp
     ui->errors->addItem(QString("%1 (%2:%3)").arg(msg).arg(inputFile.toNative()).arg(inputLine));
 }
 
-void MainWindow::convertAllFiles(ConvertFileType_t type)
+void MainWindow::convertAllFiles(eagleimport::BatchConverter::Type type)
 {
+    if (mConverter) return; // conversion already running
+
     reset();
 
     // create output directory
@@ -86,152 +85,46 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
         addError("Fatal Error: " % e.getMsg());
     }
 
-    eagleimport::ConverterDb db(FilePath(ui->uuidList->text()));
-
+    QList<FilePath> files;
     for (int i = 0; i < ui->input->count(); i++) {
-        FilePath filepath(ui->input->item(i)->text());
-        if (!filepath.isExistingFile()) {
-            addError("File not found: " % filepath.toNative());
-            continue;
-        }
-
-        convertFile(type, db, filepath);
-        ui->pbarFiles->setValue(i + 1);
-
-        if (mAbortConversion)
-            break;
-    }
-}
-
-void MainWindow::convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
-                             const FilePath& filepath)
-{
-    try {
-        parseagle::Library library(filepath.toStr());
-        db.setCurrentLibraryFilePath(filepath);
-
-        switch (type) {
-            case ConvertFileType_t::Symbols_to_Symbols:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getSymbols().count());
-                foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
-                    bool success = convertSymbol(db, symbol);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
-                }
-                break;
-            case ConvertFileType_t::Packages_to_PackagesAndDevices:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getPackages().count());
-                foreach (const parseagle::Package& package, library.getPackages()) {
-                    bool success = convertPackage(db, package);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
-                }
-                break;
-            case ConvertFileType_t::Devices_to_Components:
-                ui->pbarElements->setValue(0);
-                ui->pbarElements->setMaximum(library.getDeviceSets().count());
-                foreach (const parseagle::DeviceSet& deviceSet, library.getDeviceSets()) {
-                    bool success = convertDevice(db, deviceSet);
-                    mReadedElementsCount++;
-                    if (success) mConvertedElementsCount++;
-                    ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-                    ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
-                                                                         .arg(mReadedElementsCount));
-                }
-                break;
-            default:
-                throw Exception(__FILE__, __LINE__);
-        }
-    } catch (const std::exception& e) {
-        addError(e.what());
-        return;
-    }
-}
-
-bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
-                               const parseagle::Symbol& symbol)
-{
-    try {
-        // create symbol
-        eagleimport::SymbolConverter converter(symbol, db);
-        std::unique_ptr<Symbol> newSymbol = converter.generate();
-
-        // convert line rects to polygon rects
-        PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
-        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-        // save symbol to file
-        newSymbol->saveIntoParentDirectory(FilePath(QString("%1/sym").arg(ui->output->text())));
-    } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
-    }
-
-    return true;
-}
-
-bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
-                                const parseagle::Package& package)
-{
-    try {
-        // create package
-        eagleimport::PackageConverter converter(package, db);
-        std::unique_ptr<Package> newPackage = converter.generate();
-
-        // convert line rects to polygon rects
-        Q_ASSERT(newPackage->getFootprints().count() == 1);
-        PolygonSimplifier<Footprint> polygonSimplifier(*newPackage->getFootprints().first());
-        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-        // save package to file
-        newPackage->saveIntoParentDirectory(FilePath(QString("%1/pkg").arg(ui->output->text())));
-    } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
-    }
-
-    return true;
-}
-
-bool MainWindow::convertDevice(eagleimport::ConverterDb& db,
-                               const parseagle::DeviceSet& deviceSet)
-{
-    try {
-        // abort if device name ends with "-US" or "-US_"
-        if (deviceSet.getName().endsWith("-US")) return false;
-        if (deviceSet.getName().endsWith("-US_")) return false;
-
-        // create component
-        eagleimport::DeviceSetConverter converter(deviceSet, db);
-        std::unique_ptr<Component> newComponent = converter.generate();
-
-        // create devices
-        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
-            if (device.getPackage().isNull()) continue;
-
-            eagleimport::DeviceConverter devConverter(deviceSet, device, db);
-            std::unique_ptr<Device> newDevice = devConverter.generate();
-
-            // save device
-            newDevice->saveIntoParentDirectory(FilePath(QString("%1/dev").arg(ui->output->text())));
-        }
-
-        // save component to file
-        newComponent->saveIntoParentDirectory(FilePath(QString("%1/cmp").arg(ui->output->text())));
-    } catch (const std::exception& e) {
-        addError(e.what());
-        return false;
+        files.append(FilePath(ui->input->item(i)->text()));
     }
 
-    return true;
+    // run the conversion in a worker thread to keep the GUI responsive, the converter
+    // is released by conversionFinished() as soon as the worker thread has finished
+    mConverterDb.reset(new eagleimport::ConverterDb(FilePath(ui->uuidList->text())));
+    mConverter.reset(new eagleimport::BatchConverter(*mConverterDb, outputDir));
+    connect(mConverter.data(), &eagleimport::BatchConverter::fileStarted,
+            this, [this](int index, int count){
+        Q_UNUSED(index);
+        ui->pbarElements->setValue(0);
+        ui->pbarElements->setMaximum(count);
+    }, Qt::QueuedConnection);
+    connect(mConverter.data(), &eagleimport::BatchConverter::elementFinished,
+            this, [this](int converted, int read){
+        ui->pbarElements->setValue(ui->pbarElements->value() + 1);
+        ui->lblConvertedElements->setText(QString("%1 of %2").arg(converted).arg(read));
+    }, Qt::QueuedConnection);
+    connect(mConverter.data(), &eagleimport::BatchConverter::fileFinished,
+            this, [this](int index){
+        ui->pbarFiles->setValue(index + 1);
+    }, Qt::QueuedConnection);
+    connect(mConverter.data(), &eagleimport::BatchConverter::errorOccurred,
+            this, [this](const QString& msg){
+        addError(msg);
+    }, Qt::QueuedConnection);
+
+    eagleimport::BatchConverter* converter = mConverter.data();
+    mConverterWatcher.setFuture(QtConcurrent::run([converter, type, files](){
+        converter->convert(type, files);
+    }));
+}
+
+void MainWindow::conversionFinished() noexcept
+{
+    // the progress signals were queued before, so they are already delivered now
+    mConverter.reset();
+    mConverterDb.reset(); // writes the new UUIDs to the file
 }
 
 void MainWindow::on_inputBtn_clicked()
@@ -252,22 +145,22 @@ void MainWindow::on_outputBtn_clicked()
 
 void MainWindow::on_btnAbort_clicked()
 {
-    mAbortConversion = true;
+    if (mConverter) mConverter->abort();
 }
 
 void MainWindow::on_btnConvertSymbols_clicked()
 {
-    convertAllFiles(ConvertFileType_t::Symbols_to_Symbols);
+    convertAllFiles(eagleimport::BatchConverter::Type::Symbols);
 }
 
 void MainWindow::on_btnConvertDevices_clicked()
 {
-    convertAllFiles(ConvertFileType_t::Devices_to_Components);
+    convertAllFiles(eagleimport::BatchConverter::Type::DeviceSets);
 }
 
 void MainWindow::on_pushButton_2_clicked()
 {
-    convertAllFiles(ConvertFileType_t::Packages_to_PackagesAndDevices);
+    convertAllFiles(eagleimport::BatchConverter::Type::Packages);
 }
 
 void MainWindow::on_btnPathsFromIni_clicked()
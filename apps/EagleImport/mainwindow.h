@@ -5,17 +5,12 @@
 #include <QtWidgets>
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/fileio/filepath.h>
+#include <librepcb/eagleimport/batchconverter.h>
 
 namespace Ui {
 class MainWindow;
 }
 
-namespace parseagle {
-class Symbol;
-class Package;
-class DeviceSet;
-}
-
 namespace librepcb {
 
 namespace eagleimport {
@@ -46,30 +41,17 @@ class MainWindow : public QMainWindow
 
     private:
 
-        enum class ConvertFileType_t {
-            Symbols_to_Symbols,
-            Packages_to_PackagesAndDevices,
-            Devices_to_Components
-        };
-
         void reset();
         void addError(const QString& msg, const librepcb::FilePath& inputFile = librepcb::FilePath(), int inputLine = 0);
-        void convertAllFiles(ConvertFileType_t type);
-        void convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
-                         const librepcb::FilePath& filepath);
-        bool convertSymbol(eagleimport::ConverterDb& db,
-                           const parseagle::Symbol& symbol);
-        bool convertPackage(eagleimport::ConverterDb& db,
-                            const parseagle::Package& package);
-        bool convertDevice(eagleimport::ConverterDb& db,
-                           const parseagle::DeviceSet& deviceSet);
+        void convertAllFiles(eagleimport::BatchConverter::Type type);
+        void conversionFinished() noexcept;
 
         // Attributes
         Ui::MainWindow *ui;
-        bool mAbortConversion;
+        QScopedPointer<eagleimport::ConverterDb> mConverterDb; ///< used by #mConverter
+        QScopedPointer<eagleimport::BatchConverter> mConverter; ///< the running converter
+        QFutureWatcher<void> mConverterWatcher; ///< watches the worker thread of #mConverter
         QString mlastInputDirectory;
-        int mReadedElementsCount;
-        int mConvertedElementsCount;
 };
 
 }
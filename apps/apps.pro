@@ -2,6 +2,7 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
     librepcb \
+    librepcb-cli \
     EagleImport \
     UuidGenerator \
     WorkspaceLibraryUpdater
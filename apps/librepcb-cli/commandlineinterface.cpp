@@ -0,0 +1,375 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "commandlineinterface.h"
+#include <librepcb/common/application.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace cli {
+
+using namespace project;
+
+bool CommandLineInterface::sVerbose = false;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+CommandLineInterface::CommandLineInterface(const Application& app) noexcept :
+    mApp(app), mExportSchematics(false), mExportBoards(false), mCheckBoards(false)
+{
+}
+
+CommandLineInterface::~CommandLineInterface() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int CommandLineInterface::execute() noexcept
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription(tr("LibrePCB command line interface to export "
+                                        "projects without user interaction."));
+    parser.addHelpOption();
+    QCommandLineOption versionOption({"V", "version"}, tr("Print the version."));
+    QCommandLineOption verboseOption({"v", "verbose"}, tr("Print debug messages."));
+    QCommandLineOption jobsOption({"j", "jobs"}, tr("Number of projects to process in "
+        "parallel worker processes (default: 1)."), tr("count"), "1");
+    QCommandLineOption exportSchematicsOption("export-schematics",
+        tr("Export the schematics of each project as PDF."));
+    QCommandLineOption schematicsOutputOption("schematics-output",
+        tr("Path of the exported PDF, relative to the project directory (default: %1).")
+        .arg("output/{{VERSION}}/{{PROJECT}}_Schematics.pdf"), tr("path"),
+        "output/{{VERSION}}/{{PROJECT}}_Schematics.pdf");
+    QCommandLineOption exportBoardsOption("export-fabrication-data",
+        tr("Rebuild all planes and export the fabrication data (Gerber/Excellon) of the "
+           "boards, using the fabrication output settings of each board."));
+    QCommandLineOption drcOption("drc", tr("Run the design rule check on the boards and "
+        "print all violations (exit code is 1 if there are any)."));
+    const BoardDesignRuleCheck::Settings drcDefaults;
+    QCommandLineOption drcClearanceOption("drc-clearance", tr("Minimum copper clearance "
+        "in millimeters for --drc (default: %1).")
+        .arg(drcDefaults.minCopperClearance.toMmString()), tr("mm"),
+        drcDefaults.minCopperClearance.toMmString());
+    QCommandLineOption drcWidthOption("drc-min-width", tr("Minimum copper width in "
+        "millimeters for --drc (default: %1).")
+        .arg(drcDefaults.minCopperWidth.toMmString()), tr("mm"),
+        drcDefaults.minCopperWidth.toMmString());
+    QCommandLineOption drcAnnularRingOption("drc-annular-ring", tr("Minimum annular ring "
+        "in millimeters for --drc (default: %1).")
+        .arg(drcDefaults.minAnnularRing.toMmString()), tr("mm"),
+        drcDefaults.minAnnularRing.toMmString());
+    QCommandLineOption drcDrillOption("drc-min-drill", tr("Minimum drill diameter in "
+        "millimeters for --drc (default: %1).")
+        .arg(drcDefaults.minDrillDiameter.toMmString()), tr("mm"),
+        drcDefaults.minDrillDiameter.toMmString());
+    QCommandLineOption drcOutlineClearanceOption("drc-outline-clearance", tr("Minimum "
+        "clearance of copper to the board outline in millimeters for --drc (default: %1).")
+        .arg(drcDefaults.minOutlineClearance.toMmString()), tr("mm"),
+        drcDefaults.minOutlineClearance.toMmString());
+    QCommandLineOption boardOption("board", tr("Only export the board with this name "
+        "(can be given multiple times, default: all boards)."), tr("name"));
+    parser.addOptions({versionOption, verboseOption, jobsOption, exportSchematicsOption,
+                       schematicsOutputOption, exportBoardsOption, drcOption,
+                       drcClearanceOption, drcWidthOption, drcAnnularRingOption,
+                       drcDrillOption, drcOutlineClearanceOption, boardOption});
+    parser.addPositionalArgument("projects", tr("Project files (*.lpp) to process."),
+                                 "<project.lpp>...");
+    parser.process(mApp);
+
+    if (parser.isSet(versionOption)) {
+        print(QString("LibrePCB CLI %1 (%2)").arg(mApp.getAppVersion().toPrettyStr(3),
+                                                  mApp.getGitVersion()));
+        return 0;
+    }
+
+    sVerbose = parser.isSet(verboseOption);
+    qInstallMessageHandler(&messageHandler);
+
+    mExportSchematics = parser.isSet(exportSchematicsOption);
+    mSchematicsOutputPath = parser.value(schematicsOutputOption);
+    mExportBoards = parser.isSet(exportBoardsOption);
+    mCheckBoards = parser.isSet(drcOption);
+    mBoardNames = parser.values(boardOption);
+
+    // limits of the design rule check
+    QList<QPair<const QCommandLineOption*, Length*>> drcLimits = {
+        {&drcClearanceOption, &mDrcSettings.minCopperClearance},
+        {&drcWidthOption, &mDrcSettings.minCopperWidth},
+        {&drcAnnularRingOption, &mDrcSettings.minAnnularRing},
+        {&drcDrillOption, &mDrcSettings.minDrillDiameter},
+        {&drcOutlineClearanceOption, &mDrcSettings.minOutlineClearance},
+    };
+    for (const auto& limit : drcLimits) {
+        QString value = parser.value(*limit.first);
+        bool valid = false;
+        try {
+            *limit.second = Length::fromMm(value); // can throw
+            valid = (*limit.second >= 0);
+        } catch (const Exception&) {
+            // invalid number, handled below
+        }
+        if (!valid) {
+            printErr(tr("ERROR: Invalid value for --%1: \"%2\"")
+                     .arg(limit.first->names().first(), value));
+            return 1;
+        }
+    }
+
+    bool jobsValid = false;
+    int jobs = parser.value(jobsOption).toInt(&jobsValid);
+    QStringList projectFiles = parser.positionalArguments();
+    if ((!jobsValid) || (jobs < 1) || projectFiles.isEmpty()) {
+        printErr(parser.helpText());
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    bool success = true;
+    if ((jobs > 1) && (projectFiles.count() > 1)) {
+        success = runWorkerProcesses(projectFiles, jobs);
+    } else {
+        foreach (const QString& projectFile, projectFiles) {
+            FilePath fp(QFileInfo(projectFile).absoluteFilePath());
+            success = processProject(fp) && success;
+        }
+    }
+    printStageTime(tr("Total (%1 projects)").arg(projectFiles.count()), timer);
+    return success ? 0 : 1;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool CommandLineInterface::processProject(const FilePath& projectFile) const noexcept
+{
+    print(tr("Process project %1:").arg(projectFile.toNative()));
+    try {
+        QElapsedTimer timer;
+        timer.start();
+        Project project(projectFile, true); // read-only, can throw
+        printStageTime(tr("Open project"), timer);
+
+        if (mExportSchematics) {
+            exportSchematics(project); // can throw
+        }
+        if (mExportBoards) {
+            exportBoards(project); // can throw
+        }
+        if (mCheckBoards) {
+            return checkBoards(project); // can throw
+        }
+        return true;
+    } catch (const Exception& e) {
+        printErr(tr("ERROR in %1: %2").arg(projectFile.toNative(), e.getMsg()));
+        return false;
+    }
+}
+
+void CommandLineInterface::exportSchematics(Project& project) const
+{
+    QElapsedTimer timer;
+    timer.start();
+    QString path = AttributeSubstitutor::substitute(mSchematicsOutputPath, &project,
+        [](const QString& str){
+            return FilePath::cleanFileName(str, FilePath::ReplaceSpaces | FilePath::KeepCase);
+        });
+    FilePath filepath = QDir::isAbsolutePath(path) ? FilePath(path)
+                                                   : project.getPath().getPathTo(path);
+    QDir().mkpath(filepath.getParentDir().toStr());
+    project.exportSchematicsAsPdf(filepath); // can throw
+    printStageTime(tr("Export schematics to %1").arg(filepath.toNative()), timer);
+}
+
+void CommandLineInterface::exportBoards(Project& project) const
+{
+    foreach (Board* board, project.getBoards()) {
+        if ((!mBoardNames.isEmpty()) && (!mBoardNames.contains(board->getName()))) {
+            continue;
+        }
+
+        // rebuild planes because they may be outdated!
+        QElapsedTimer timer;
+        timer.start();
+        board->rebuildAllPlanes();
+        printStageTime(tr("Rebuild planes of board \"%1\"").arg(board->getName()), timer);
+
+        timer.restart();
+        BoardGerberExport grbExport(*board);
+        grbExport.exportAllLayers(); // can throw
+        printStageTime(tr("Export fabrication data of board \"%1\" to %2")
+                       .arg(board->getName(), grbExport.getOutputDirectory().toNative()),
+                       timer);
+        foreach (const BoardGerberExport::DrillTravelLength& drill,
+                 grbExport.getDrillTravelLengths()) {
+            print(tr("  Drill travel length of %1: %2 mm (%3 mm before optimization)")
+                  .arg(drill.filepath.getFilename(), drill.optimized.toMmString(),
+                       drill.original.toMmString()));
+        }
+    }
+}
+
+bool CommandLineInterface::checkBoards(Project& project) const
+{
+    bool success = true;
+    foreach (Board* board, project.getBoards()) {
+        if ((!mBoardNames.isEmpty()) && (!mBoardNames.contains(board->getName()))) {
+            continue;
+        }
+
+        // rebuild planes because they may be outdated (already done by the export)
+        QElapsedTimer timer;
+        if (!mExportBoards) {
+            timer.start();
+            board->rebuildAllPlanes();
+            printStageTime(tr("Rebuild planes of board \"%1\"").arg(board->getName()), timer);
+        }
+
+        timer.start();
+        BoardDesignRuleCheck& drc = board->getDesignRuleCheck();
+        drc.setSettings(mDrcSettings);
+        int count = drc.execute(); // can throw
+        printStageTime(tr("Check design rules of board \"%1\" (%2 violations)")
+                       .arg(board->getName()).arg(count), timer);
+        foreach (const QString& msg, drc.getViolationMessages()) {
+            printErr("  - " % msg);
+        }
+        success = success && (count == 0);
+    }
+    return success;
+}
+
+bool CommandLineInterface::runWorkerProcesses(const QStringList& projectFiles,
+                                              int jobs) const noexcept
+{
+    // the worker processes get the same options, but only one project each
+    QStringList options;
+    if (sVerbose) options << "--verbose";
+    if (mExportSchematics) options << "--export-schematics";
+    options << "--schematics-output" << mSchematicsOutputPath;
+    if (mExportBoards) options << "--export-fabrication-data";
+    if (mCheckBoards) {
+        options << "--drc";
+        options << "--drc-clearance" << mDrcSettings.minCopperClearance.toMmString();
+        options << "--drc-min-width" << mDrcSettings.minCopperWidth.toMmString();
+        options << "--drc-annular-ring" << mDrcSettings.minAnnularRing.toMmString();
+        options << "--drc-min-drill" << mDrcSettings.minDrillDiameter.toMmString();
+        options << "--drc-outline-clearance"
+                << mDrcSettings.minOutlineClearance.toMmString();
+    }
+    foreach (const QString& name, mBoardNames) {
+        options << "--board" << name;
+    }
+
+    QStringList pending = projectFiles;
+    QList<QProcess*> running;
+    bool success = true;
+    QEventLoop loop;
+    auto startNext = [&](){
+        while ((!pending.isEmpty()) && (running.count() < jobs)) {
+            QString projectFile = pending.takeFirst();
+            QProcess* process = new QProcess();
+            process->setProcessChannelMode(QProcess::ForwardedChannels);
+            QObject::connect(process,
+                static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+                &loop, [&, process, projectFile](int exitCode, QProcess::ExitStatus status){
+                    if ((status != QProcess::NormalExit) || (exitCode != 0)) {
+                        printErr(tr("ERROR: Worker process for %1 failed.").arg(projectFile));
+                        success = false;
+                    }
+                    running.removeOne(process);
+                    process->deleteLater();
+                    loop.quit();
+                });
+            running.append(process);
+            process->start(QCoreApplication::applicationFilePath(),
+                           QStringList(options) << projectFile);
+            if (!process->waitForStarted()) {
+                printErr(tr("ERROR: Could not start worker process for %1.").arg(projectFile));
+                success = false;
+                running.removeOne(process);
+                delete process;
+            }
+        }
+    };
+
+    startNext();
+    while (!running.isEmpty()) {
+        loop.exec();
+        startNext();
+    }
+    return success;
+}
+
+void CommandLineInterface::printStageTime(const QString& stage,
+                                          const QElapsedTimer& timer) const noexcept
+{
+    print(QString("  %1: %2 ms").arg(stage).arg(timer.elapsed()));
+}
+
+void CommandLineInterface::print(const QString& str) const noexcept
+{
+    QTextStream s(stdout);
+    s << str << endl;
+}
+
+void CommandLineInterface::printErr(const QString& str) const noexcept
+{
+    QTextStream s(stderr);
+    s << str << endl;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void CommandLineInterface::messageHandler(QtMsgType type, const QMessageLogContext& context,
+                                          const QString& msg) noexcept
+{
+    Q_UNUSED(context);
+    if (((type == QtDebugMsg) || (type == QtInfoMsg)) && (!sVerbose)) {
+        return; // don't pollute the output with debug messages of the libraries
+    }
+    QTextStream s(stderr);
+    s << msg << endl;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
@@ -0,0 +1,122 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_CLI_COMMANDLINEINTERFACE_H
+#define LIBREPCB_CLI_COMMANDLINEINTERFACE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Application;
+
+namespace project {
+class Project;
+}
+
+namespace cli {
+
+/*****************************************************************************************
+ *  Class CommandLineInterface
+ ****************************************************************************************/
+
+/**
+ * @brief The CommandLineInterface class runs exports of projects without any GUI
+ *
+ * Projects are always opened in read-only mode, so they can even be exported while
+ * they are opened in the GUI. The time needed for each stage (opening, plane rebuild,
+ * exports) is printed to stdout. With `--drc`, the design rule check is run on the
+ * boards and all violations are printed (the exit code is non-zero if there are any).
+ * The limits of the check can be changed with the `--drc-*` options (in millimeters).
+ *
+ * If multiple projects are given and more than one job is requested, each project is
+ * processed in a separate worker process (the executable calls itself) to make use of
+ * multiple CPU cores and to isolate crashes of single projects.
+ */
+class CommandLineInterface final
+{
+        Q_DECLARE_TR_FUNCTIONS(CommandLineInterface)
+
+    public:
+
+        // Constructors / Destructor
+        CommandLineInterface() = delete;
+        CommandLineInterface(const CommandLineInterface& other) = delete;
+        explicit CommandLineInterface(const Application& app) noexcept;
+        ~CommandLineInterface() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Parse the command line arguments and execute the requested actions
+         *
+         * @return The process exit code (0 on success)
+         */
+        int execute() noexcept;
+
+        // Operator Overloadings
+        CommandLineInterface& operator=(const CommandLineInterface& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        bool processProject(const FilePath& projectFile) const noexcept;
+        void exportSchematics(project::Project& project) const;
+        void exportBoards(project::Project& project) const;
+        bool checkBoards(project::Project& project) const;
+        bool runWorkerProcesses(const QStringList& projectFiles, int jobs) const noexcept;
+        void printStageTime(const QString& stage, const QElapsedTimer& timer) const noexcept;
+        void print(const QString& str) const noexcept;
+        void printErr(const QString& str) const noexcept;
+
+        // Static Methods
+        static void messageHandler(QtMsgType type, const QMessageLogContext& context,
+                                   const QString& msg) noexcept;
+
+
+        // Attributes
+        const Application& mApp;
+        QStringList mArguments;
+        bool mExportSchematics;
+        QString mSchematicsOutputPath;
+        bool mExportBoards;
+        bool mCheckBoards;
+        project::BoardDesignRuleCheck::Settings mDrcSettings;
+        QStringList mBoardNames;
+        static bool sVerbose;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
+
+#endif // LIBREPCB_CLI_COMMANDLINEINTERFACE_H
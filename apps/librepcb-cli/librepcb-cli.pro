@@ -0,0 +1,57 @@
+#-------------------------------------------------
+#
+# Headless command line interface for exports (e.g. for continuous integration)
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-cli
+
+# Use common project definitions
+include(../../common.pri)
+
+# Note: "widgets" and "printsupport" are still needed by the libraries (e.g. for the
+# PDF export), but the CLI itself never creates any widget.
+QT += core widgets opengl network xml printsupport sql
+
+CONFIG += console
+CONFIG -= app_bundle
+
+# Files to be installed by "make install"
+target.path = $${PREFIX}/bin
+INSTALLS += target
+
+# Note: The order of the libraries is very important for the linker!
+# Another order could end up in "undefined reference" errors!
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbproject \
+    -llibrepcblibrary \
+    -llibrepcbcommon \
+    -lsexpresso \
+    -lclipper \
+
+INCLUDEPATH += \
+    ../../libs
+
+DEPENDPATH += \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/sexpresso \
+    ../../libs/clipper \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libsexpresso.a \
+    $${DESTDIR}/libclipper.a \
+
+SOURCES += \
+    commandlineinterface.cpp \
+    main.cpp \
+
+HEADERS += \
+    commandlineinterface.h \
+
@@ -34,90 +34,135 @@ namespace librepcb {
  ****************************************************************************************/
 
 QString AttributeSubstitutor::substitute(QString str, const AttributeProvider* ap,
-                                         FilterFunction filter) noexcept
+                                         FilterFunction filter,
+                                         QHash<QString, QString>* usedAttributes) noexcept
 {
-    int startPos = 0;
-    int length = 0;
-    int outerVariableStart = -1;
-    int outerVariableEnd = -1; // counted from end of string
-    QString value;
-    QStringList keys;
+    QSharedPointer<const Template> t = getTemplate(str);
+    if (!t->hasVariables) {
+        return str;
+    }
+
+    QString output;
+    output.reserve(str.length());
     QSet<QString> keyBacktrace; // avoid endless recursion
-    while (searchVariablesInText(str, startPos, startPos, length, keys)) {
-        if (filter && (startPos + length > str.length() - outerVariableEnd)) {
-            applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-        }
-        if (filter && (outerVariableStart < 0)) {
-            outerVariableStart = startPos;
-            outerVariableEnd = str.length() - length - startPos;
-        }
-        bool keyFound = false;
-        foreach (const QString& key, keys) {
-            if (key.startsWith('\'') && key.endsWith('\'')) {
-                // replace "{{'VALUE'}}" with "VALUE"
-                str.replace(startPos, length, key.mid(1, key.length()-2));
-                startPos += key.length() - 2; // do not search for variables in the value
-                keyFound = true;
-                break;
-            } else if ((getValueOfKey(key, value, ap)) && (!keyBacktrace.contains(key))) {
-                // replace "{{KEY}}" with the value of KEY
-                str.replace(startPos, length, value);
-                keyBacktrace.insert(key);
-                keyFound = true;
-                break;
-            }
-        }
-        if (!keyFound) {
-            // attribute not found, remove "{{KEY}}" from str
-            str.remove(startPos, length);
+    foreach (const Segment& segment, t->segments) {
+        if (segment.keys.isEmpty()) {
+            output.append(segment.text);
+        } else if (filter) {
+            // the filter is applied to the whole substituted value of outer variables
+            QString value;
+            appendVariable(segment, ap, keyBacktrace, usedAttributes, value);
+            output.append(filter(value));
+        } else {
+            appendVariable(segment, ap, keyBacktrace, usedAttributes, output);
         }
     }
-    if (filter && (outerVariableStart >= 0)) {
-        applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-    }
-    return str;
+    return output;
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-bool AttributeSubstitutor::searchVariablesInText(const QString& text, int startPos, int& pos,
-                                                 int& length, QStringList& keys) noexcept
+QSharedPointer<const AttributeSubstitutor::Template> AttributeSubstitutor::getTemplate(
+    const QString& str) noexcept
+{
+    static QMutex mutex;
+    static QHash<QString, QSharedPointer<const Template>> cache;
+
+    QMutexLocker locker(&mutex);
+    QSharedPointer<const Template> t = cache.value(str);
+    if (!t) {
+        if (cache.count() >= sMaxCachedTemplates) {
+            cache.clear(); // templates still in use are kept alive by their shared pointer
+        }
+        t.reset(new Template(parseTemplate(str)));
+        cache.insert(str, t);
+    }
+    return t;
+}
+
+AttributeSubstitutor::Template AttributeSubstitutor::parseTemplate(const QString& str) noexcept
 {
-    QRegularExpression re("\\{\\{(.*?)\\}\\}");
-    QRegularExpressionMatch match = re.match(text, startPos);
-    if (match.hasMatch() && match.capturedLength() > 0) {
-        pos = match.capturedStart();
-        if (text.midRef(pos).startsWith("{{ '}}' }}")) {
+    static const QRegularExpression re("\\{\\{(.*?)\\}\\}");
+
+    Template t;
+    t.hasVariables = false;
+    int startPos = 0;
+    while (startPos < str.length()) {
+        QRegularExpressionMatch match = re.match(str, startPos);
+        if ((!match.hasMatch()) || (match.capturedLength() <= 0)) {
+            break;
+        }
+        int pos = match.capturedStart();
+        Segment variable;
+        int length;
+        if (str.midRef(pos).startsWith("{{ '}}' }}")) {
             // special case to escape '}}' as it doesn't work with the regex above
             length = 10;
-            keys = QStringList{"'}}'"};
+            variable.keys = QStringList{"'}}'"};
         } else {
             length = match.capturedLength();
-            keys = match.captured(1).split(" or ");
-            for (QString& key : keys) {key = key.trimmed();}
+            variable.keys = match.captured(1).split(" or ");
+            for (QString& key : variable.keys) {key = key.trimmed();}
         }
-        return true;
-    } else {
-        return false;
+        if (pos > startPos) {
+            t.segments.append(Segment{str.mid(startPos, pos - startPos), QStringList()});
+        }
+        t.segments.append(variable);
+        t.hasVariables = true;
+        startPos = pos + length;
+    }
+    if (startPos < str.length()) {
+        t.segments.append(Segment{str.mid(startPos), QStringList()});
     }
+    return t;
 }
 
-void AttributeSubstitutor::applyFilter(QString& str, int& start, int& end,
-                                       FilterFunction filter) noexcept
+void AttributeSubstitutor::appendTemplate(const Template& t, const AttributeProvider* ap,
+                                          QSet<QString>& keyBacktrace,
+                                          QHash<QString, QString>* usedAttributes,
+                                          QString& output) noexcept
 {
-    int length = str.length() - end - start;
-    str.replace(start, length, filter(str.mid(start, length)));
-    start = -1;
-    end = -1;
+    foreach (const Segment& segment, t.segments) {
+        if (segment.keys.isEmpty()) {
+            output.append(segment.text);
+        } else {
+            appendVariable(segment, ap, keyBacktrace, usedAttributes, output);
+        }
+    }
+}
+
+void AttributeSubstitutor::appendVariable(const Segment& variable,
+                                          const AttributeProvider* ap,
+                                          QSet<QString>& keyBacktrace,
+                                          QHash<QString, QString>* usedAttributes,
+                                          QString& output) noexcept
+{
+    QString value;
+    foreach (const QString& key, variable.keys) {
+        if (key.startsWith('\'') && key.endsWith('\'')) {
+            // replace "{{'VALUE'}}" with "VALUE" (without substituting variables in it)
+            output.append(key.mid(1, key.length()-2));
+            return;
+        } else if ((getValueOfKey(key, value, ap, usedAttributes)) &&
+                   (!keyBacktrace.contains(key))) {
+            // replace "{{KEY}}" with the (substituted) value of KEY
+            keyBacktrace.insert(key);
+            appendTemplate(*getTemplate(value), ap, keyBacktrace, usedAttributes, output);
+            return;
+        }
+    }
+    // attribute not found, remove "{{KEY}}"
 }
 
 bool AttributeSubstitutor::getValueOfKey(const QString& key, QString& value,
-                                         const AttributeProvider* ap) noexcept
+                                         const AttributeProvider* ap,
+                                         QHash<QString, QString>* usedAttributes) noexcept
 {
     if (ap) {
         value = ap->getAttributeValue(key);
+        if (usedAttributes) usedAttributes->insert(key, value);
         return !value.isEmpty();
     } else {
         return false;
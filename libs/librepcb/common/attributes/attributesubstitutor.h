@@ -77,37 +77,80 @@ class AttributeSubstitutor final
          *
          * @param str       A string which can contain variables ("{{NAME}}"). The
          *                  attributes will be substituted directly in this string.
+         * @param ap        The attribute provider to fetch the attribute values from
+         * @param filter    Optional filter applied to the substituted values
+         * @param usedAttributes    If not nullptr, all attribute keys which were looked
+         *                          up in the attribute provider are added to this hash,
+         *                          together with their (possibly empty) values. The
+         *                          result only changes if one of these values changes.
          *
          * @return True if str was modified in some way, false if not
          */
         static QString substitute(QString str, const AttributeProvider* ap = nullptr,
-                                  FilterFunction filter = nullptr) noexcept;
+                                  FilterFunction filter = nullptr,
+                                  QHash<QString, QString>* usedAttributes = nullptr) noexcept;
+
+
+    private: // Types
+
+        /// A variable (e.g. "{{KEY or FALLBACK}}") or a literal text part of a template
+        struct Segment {
+            QString text;       ///< the literal text (only if not a variable)
+            QStringList keys;   ///< the variable key names (empty if literal text)
+        };
+
+        /// A string parsed into literal text and variable segments
+        struct Template {
+            QVector<Segment> segments;
+            bool hasVariables;
+        };
 
 
     private: // Methods
 
         /**
-         * @brief Search the next variables (e.g. "{{KEY or FALLBACK}}") in a given text
+         * @brief Get the parsed template of a string
+         *
+         * Templates are parsed only once per distinct string and then kept in a global
+         * (thread-safe) cache, since the same strings ("{{NAME}}", "{{VALUE}}", ...) are
+         * substituted over and over again.
+         *
+         * @param str       A string which can contain variables
+         *
+         * @return The (shared) parsed template
+         */
+        static QSharedPointer<const Template> getTemplate(const QString& str) noexcept;
+
+        /**
+         * @brief Parse a string into literal text and variable segments
+         *
+         * Variables are searched with the regex "\{\{(.*?)\}\}", and their key names
+         * (text between '{{' and '}}') are split by ' or '. The special case "{{ '}}' }}"
+         * is used to escape '}}'.
          *
-         * @param text      A text which can contain variables
-         * @param startPos  The search start index (use 0 to search in the whole text)
-         * @param pos       The index of the next variable in the specified text (index of
-         *                  the first '{' character, or -1 if no variable found) will be
-         *                  written into this variable.
-         * @param length    If a variable is found, the length (incl. '{{}}') will be
-         *                  written into this variable.
-         * @param keys      The variable key names (text between '{{' and '}}', split by
-         *                 ' or ')
+         * @param str       A string which can contain variables
          *
-         * @return          true if a variable is found, false if not
+         * @return The parsed template
          */
-        static bool searchVariablesInText(const QString& text, int startPos, int& pos,
-                                          int& length, QStringList& keys) noexcept;
+        static Template parseTemplate(const QString& str) noexcept;
 
-        static void applyFilter(QString& str, int& start, int& end, FilterFunction filter) noexcept;
+        static void appendTemplate(const Template& t, const AttributeProvider* ap,
+                                   QSet<QString>& keyBacktrace,
+                                   QHash<QString, QString>* usedAttributes,
+                                   QString& output) noexcept;
+
+        static void appendVariable(const Segment& variable, const AttributeProvider* ap,
+                                   QSet<QString>& keyBacktrace,
+                                   QHash<QString, QString>* usedAttributes,
+                                   QString& output) noexcept;
 
         static bool getValueOfKey(const QString& key, QString& value,
-                                  const AttributeProvider* ap) noexcept;
+                                  const AttributeProvider* ap,
+                                  QHash<QString, QString>* usedAttributes) noexcept;
+
+
+    private: // Data
+        static constexpr int sMaxCachedTemplates = 10000;
 };
 
 /*****************************************************************************************
@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <algorithm>
 #include "excellongenerator.h"
 #include "../fileio/smarttextfile.h"
 #include "../application.h"
@@ -35,7 +36,8 @@ namespace librepcb {
  ****************************************************************************************/
 
 ExcellonGenerator::ExcellonGenerator() noexcept :
-    mOutput()
+    mOptimizeDrillOrder(false), mOptimizationMaxPasses(sDefaultOptimizationPasses),
+    mRepeatCountX(1), mRepeatCountY(1), mRepeatStep(0, 0), mOutput()
 {
 }
 
@@ -43,17 +45,50 @@ ExcellonGenerator::~ExcellonGenerator() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void ExcellonGenerator::setStepAndRepeat(int countX, int countY, const Point& step) noexcept
+{
+    Q_ASSERT((countX >= 1) && (countY >= 1));
+    mRepeatCountX = qMax(countX, 1);
+    mRepeatCountY = qMax(countY, 1);
+    mRepeatStep = step;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void ExcellonGenerator::drill(const Point& pos, const Length& dia) noexcept
 {
-    mDrillList.insert(dia, pos);
+    mDrillList[dia].append(pos);
 }
 
 void ExcellonGenerator::generate()
 {
+    // estimate travel length with the drills in their original order
+    Point pos(0, 0);
+    qreal travel = 0;
+    foreach (const QVector<Point>& drills, mDrillList) {
+        travel += calcTravelLength(drills, pos);
+    }
+    mTravelLengthUnoptimized = Length(qRound64(travel));
+
+    // optimize order of the drills of each tool
+    if (mOptimizeDrillOrder) {
+        pos = Point(0, 0);
+        travel = 0;
+        for (auto it = mDrillList.begin(); it != mDrillList.end(); ++it) {
+            optimizeDrillOrder(it.value(), pos, mOptimizationMaxPasses);
+            travel += calcTravelLength(it.value(), pos);
+        }
+        mTravelLengthOptimized = Length(qRound64(travel));
+    } else {
+        mTravelLengthOptimized = mTravelLengthUnoptimized;
+    }
+
     mOutput.clear();
     printHeader();
     printDrills();
@@ -71,6 +106,8 @@ void ExcellonGenerator::reset() noexcept
 {
     mOutput.clear();
     mDrillList.clear();
+    mTravelLengthUnoptimized = Length(0);
+    mTravelLengthOptimized = Length(0);
 }
 
 /*****************************************************************************************
@@ -98,21 +135,45 @@ void ExcellonGenerator::printHeader() noexcept
 
 void ExcellonGenerator::printToolList() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        Length dia = mDrillList.uniqueKeys().value(i);
-        mOutput.append(QString("T%1C%2\n").arg(i+1).arg(dia.toMmString()));
+    int tool = 1;
+    for (auto it = mDrillList.constBegin(); it != mDrillList.constEnd(); ++it) {
+        mOutput.append(QString("T%1C%2\n").arg(tool++).arg(it.key().toMmString()));
     }
 }
 
 void ExcellonGenerator::printDrills() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        mOutput.append(QString("T%1\n").arg(i+1)); // Select Tool
-        Length dia = mDrillList.uniqueKeys().value(i);
-        foreach (const Point& pos, mDrillList.values(dia)) {
+    bool stepAndRepeat = (mRepeatCountX > 1) || (mRepeatCountY > 1);
+    int tool = 1;
+    for (auto it = mDrillList.constBegin(); it != mDrillList.constEnd(); ++it) {
+        mOutput.append(QString("T%1\n").arg(tool++)); // Select Tool
+        if (stepAndRepeat) {
+            mOutput.append("M25\n");    // Beginning of Pattern
+        }
+        foreach (const Point& pos, it.value()) {
             mOutput.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
                                                    pos.getY().toMmString()));
         }
+        if (stepAndRepeat) {
+            mOutput.append("M01\n");    // End of Pattern
+            printPatternRepeats();
+            mOutput.append("M08\n");    // End of Step and Repeat
+        }
+    }
+}
+
+void ExcellonGenerator::printPatternRepeats() noexcept
+{
+    // The offsets are relative to the original pattern. The copies are visited row by
+    // row in alternating direction to keep the travel distance between them short.
+    for (int y = 0; y < mRepeatCountY; ++y) {
+        for (int i = 0; i < mRepeatCountX; ++i) {
+            int x = (y % 2 == 0) ? i : (mRepeatCountX - 1 - i);
+            if ((x == 0) && (y == 0)) continue; // original pattern
+            Length dx = mRepeatStep.getX() * x;
+            Length dy = mRepeatStep.getY() * y;
+            mOutput.append(QString("M02X%1Y%2\n").arg(dx.toMmString(), dy.toMmString()));
+        }
     }
 }
 
@@ -122,6 +183,101 @@ void ExcellonGenerator::printFooter() noexcept
     mOutput.append("M30\n");        // End of Program Rewind
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void ExcellonGenerator::optimizeDrillOrder(QVector<Point>& drills, const Point& startPos,
+                                           int maxPasses) noexcept
+{
+    if (drills.count() < 3) return;
+
+    // sort drills along a Hilbert curve through their bounding rectangle
+    LengthBase_t minX = drills.first().getX().toNm(), maxX = minX;
+    LengthBase_t minY = drills.first().getY().toNm(), maxY = minY;
+    foreach (const Point& p, drills) {
+        minX = qMin(minX, p.getX().toNm()); maxX = qMax(maxX, p.getX().toNm());
+        minY = qMin(minY, p.getY().toNm()); maxY = qMax(maxY, p.getY().toNm());
+    }
+    qreal scale = 65535.0 / qMax(qreal(1), qreal(qMax(maxX - minX, maxY - minY)));
+    QVector<QPair<quint64, Point>> sorted;
+    sorted.reserve(drills.count());
+    foreach (const Point& p, drills) {
+        quint32 x = static_cast<quint32>((p.getX().toNm() - minX) * scale);
+        quint32 y = static_cast<quint32>((p.getY().toNm() - minY) * scale);
+        sorted.append(qMakePair(calcHilbertIndex(x, y), p));
+    }
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const QPair<quint64, Point>& a, const QPair<quint64, Point>& b){
+            return a.first < b.first;});
+    QVector<Point> path;
+    path.reserve(drills.count() + 1);
+    path.append(startPos); // fixed start, not part of the output
+    for (const QPair<quint64, Point>& pair : sorted) {
+        path.append(pair.second);
+    }
+
+    // improve with 2-opt moves (reverse path[i+1..j]) between nearby drills
+    int n = path.count();
+    bool improved = true;
+    for (int pass = 0; improved && (pass < maxPasses); ++pass) {
+        improved = false;
+        for (int i = 0; i < n - 2; ++i) {
+            int jMax = qMin(n - 1, i + sTwoOptWindowSize);
+            for (int j = i + 2; j <= jMax; ++j) {
+                qreal delta = distance(path.at(i), path.at(j))
+                            - distance(path.at(i), path.at(i + 1));
+                if (j < n - 1) { // the end of the path is open
+                    delta += distance(path.at(i + 1), path.at(j + 1))
+                           - distance(path.at(j), path.at(j + 1));
+                }
+                if (delta < -1) { // ignore improvements below 1nm (rounding errors)
+                    std::reverse(path.begin() + i + 1, path.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    drills = path.mid(1);
+}
+
+quint64 ExcellonGenerator::calcHilbertIndex(quint32 x, quint32 y) noexcept
+{
+    // see https://en.wikipedia.org/wiki/Hilbert_curve (16 bit per coordinate)
+    quint64 d = 0;
+    for (quint32 s = 1 << 15; s > 0; s >>= 1) {
+        quint32 rx = (x & s) > 0 ? 1 : 0;
+        quint32 ry = (y & s) > 0 ? 1 : 0;
+        d += quint64(s) * quint64(s) * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = 0xFFFF - x;
+                y = 0xFFFF - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+qreal ExcellonGenerator::calcTravelLength(const QVector<Point>& drills, Point& pos) noexcept
+{
+    qreal length = 0;
+    foreach (const Point& p, drills) {
+        length += distance(pos, p);
+        pos = p;
+    }
+    return length;
+}
+
+qreal ExcellonGenerator::distance(const Point& p1, const Point& p2) noexcept
+{
+    qreal dx = p2.getX().toNm() - p1.getX().toNm();
+    qreal dy = p2.getY().toNm() - p1.getY().toNm();
+    return qSqrt(dx * dx + dy * dy);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -40,6 +40,12 @@ namespace librepcb {
 /**
  * @brief The ExcellonGenerator class
  *
+ * Optionally, the drills of each tool can be reordered to reduce the travel distance
+ * of the drilling machine (see #setOptimizeDrillOrder()). The holes are then sorted
+ * along a Hilbert curve first, and afterwards improved with 2-opt moves between nearby
+ * holes until no more improvement is found or the pass limit is reached. The result
+ * does not depend on the machine speed, so the output is reproducible.
+ *
  * @author ubruhin
  * @date 2016-03-31
  */
@@ -58,6 +64,48 @@ class ExcellonGenerator final
         // Getters
         const QString& toStr() const noexcept {return mOutput;}
 
+        /**
+         * @brief Get the estimated travel length of the drilling machine
+         *
+         * Only valid after calling #generate().
+         *
+         * @param optimized     If true, the travel length of the generated output is
+         *                      returned. Otherwise the travel length with the drills in
+         *                      the order they were added is returned.
+         *
+         * @return The sum of the distances between consecutive drills (all tools)
+         */
+        Length getTravelLength(bool optimized) const noexcept {
+            return optimized ? mTravelLengthOptimized : mTravelLengthUnoptimized;
+        }
+
+        // Setters
+
+        /**
+         * @brief Enable or disable the optimization of the drill order
+         *
+         * @param optimize      Whether the drills should be reordered or not
+         * @param maxPasses     Maximum number of 2-opt passes over the drills of a tool
+         */
+        void setOptimizeDrillOrder(bool optimize,
+                                   int maxPasses = sDefaultOptimizationPasses) noexcept {
+            mOptimizeDrillOrder = optimize;
+            mOptimizationMaxPasses = maxPasses;
+        }
+
+        /**
+         * @brief Repeat all drills in a grid of copies (panelization)
+         *
+         * The drills of each tool are written only once as a pattern (M25/M01) which
+         * is then repeated with offset commands (M02), matching the step and repeat
+         * blocks of librepcb::GerberGenerator::setStepAndRepeat().
+         *
+         * @param countX    Number of copies in X direction (columns)
+         * @param countY    Number of copies in Y direction (rows)
+         * @param step      Distance between the origins of two neighbouring copies
+         */
+        void setStepAndRepeat(int countX, int countY, const Point& step) noexcept;
+
         // General Methods
         void drill(const Point& pos, const Length& dia) noexcept;
         void generate();
@@ -73,12 +121,31 @@ class ExcellonGenerator final
         void printHeader() noexcept;
         void printToolList() noexcept;
         void printDrills() noexcept;
+        void printPatternRepeats() noexcept;
         void printFooter() noexcept;
 
+        // Static Methods
+        static void optimizeDrillOrder(QVector<Point>& drills, const Point& startPos,
+                                       int maxPasses) noexcept;
+        static quint64 calcHilbertIndex(quint32 x, quint32 y) noexcept;
+        static qreal calcTravelLength(const QVector<Point>& drills, Point& pos) noexcept;
+        static qreal distance(const Point& p1, const Point& p2) noexcept;
+
+
+        // Settings
+        static constexpr int sDefaultOptimizationPasses = 16;
+        static constexpr int sTwoOptWindowSize = 32; ///< max. distance of 2-opt candidates
+        bool mOptimizeDrillOrder;
+        int mOptimizationMaxPasses;
+        int mRepeatCountX;
+        int mRepeatCountY;
+        Point mRepeatStep;
 
         // Excellon Data
         QString mOutput;
-        QMultiMap<Length, Point> mDrillList;
+        QMap<Length, QVector<Point>> mDrillList; ///< key: diameter; value: positions
+        Length mTravelLengthUnoptimized;
+        Length mTravelLengthOptimized;
 };
 
 /*****************************************************************************************
@@ -64,40 +64,49 @@ QString GerberApertureList::generateString() const noexcept
 
 int GerberApertureList::setCircle(const Length& dia, const Length& hole)
 {
-    return setCurrentAperture(generateCircle(dia, hole));
+    return addAperture(makeKey(ApertureShape::Circle, dia, Length(0), hole),
+                       [&](){return generateCircle(dia, hole);});
 }
 
 int GerberApertureList::setRect(const Length& w, const Length& h, const Angle& rot, const Length& hole) noexcept
 {
     if (rot % Angle::deg180() == 0) {
-        return setCurrentAperture(generateRect(w, h, hole));
+        return addAperture(makeKey(ApertureShape::Rect, w, h, hole),
+                           [&](){return generateRect(w, h, hole);});
     } else if (rot % Angle::deg90() == 0) {
-        return setCurrentAperture(generateRect(h, w, hole));
+        return addAperture(makeKey(ApertureShape::Rect, h, w, hole),
+                           [&](){return generateRect(h, w, hole);});
     } else {
-        // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
-        if (hole > 0) {
-            addMacro(generateRotatedRectMacroWithHole());
-        } else {
-            addMacro(generateRotatedRectMacro());
-        }
-        return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
+        return addAperture(makeKey(ApertureShape::RotatedRect, w, h, hole, rot), [&](){
+            // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
+            if (hole > 0) {
+                addMacro(generateRotatedRectMacroWithHole());
+            } else {
+                addMacro(generateRotatedRectMacro());
+            }
+            return generateRotatedRect(w, h, rot, hole);
+        });
     }
 }
 
 int GerberApertureList::setObround(const Length& w, const Length& h, const Angle& rot, const Length& hole) noexcept
 {
     if (rot % Angle::deg180() == 0) {
-        return setCurrentAperture(generateObround(w, h, hole));
+        return addAperture(makeKey(ApertureShape::Obround, w, h, hole),
+                           [&](){return generateObround(w, h, hole);});
     } else if (rot % Angle::deg90() == 0) {
-        return setCurrentAperture(generateObround(h, w, hole));
+        return addAperture(makeKey(ApertureShape::Obround, h, w, hole),
+                           [&](){return generateObround(h, w, hole);});
     } else {
-        // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
-        if (hole > 0) {
-            addMacro(generateRotatedObroundMacroWithHole());
-        } else {
-            addMacro(generateRotatedObroundMacro());
-        }
-        return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
+        return addAperture(makeKey(ApertureShape::RotatedObround, w, h, hole, rot), [&](){
+            // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
+            if (hole > 0) {
+                addMacro(generateRotatedObroundMacroWithHole());
+            } else {
+                addMacro(generateRotatedObroundMacro());
+            }
+            return generateRotatedObround(w, h, rot, hole);
+        });
     }
 }
 
@@ -108,27 +117,55 @@ int GerberApertureList::setRegularPolygon(const Length& dia, int n, const Angle&
     }
     // Adjust rotation as its interpretation differs between LibrePCB and Gerber specs
     Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
-    return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+    return addAperture(makeKey(ApertureShape::RegularPolygon, dia, Length(0), hole, grbRot, n),
+                       [&](){return generateRegularPolygon(dia, n, grbRot, hole);});
 }
 
 void GerberApertureList::reset() noexcept
 {
     //mApertureMacros.clear();
     mApertures.clear();
+    mApertureNumbers.clear();
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept
+GerberApertureList::ApertureKey GerberApertureList::makeKey(ApertureShape shape,
+    const Length& size1, const Length& size2, const Length& hole, const Angle& rot,
+    int vertices) noexcept
 {
+    ApertureKey key;
+    key.shape = shape;
+    key.size1 = size1.toNm();
+    key.size2 = size2.toNm();
+    key.hole = (hole > 0) ? hole.toNm() : 0; // non-positive holes are ignored anyway
+    key.rotation = rot.toMicroDeg();
+    key.vertices = vertices;
+    return key;
+}
+
+template <typename Generator>
+int GerberApertureList::addAperture(const ApertureKey& key, Generator generate) noexcept
+{
+    auto it = mApertureNumbers.constFind(key);
+    if (it != mApertureNumbers.constEnd()) {
+        return *it; // the definition doesn't need to be generated at all
+    }
+    return insertAperture(key, generate());
+}
+
+int GerberApertureList::insertAperture(const ApertureKey& key, const QString& aperture) noexcept
+{
+    // different keys may still lead to the same definition (e.g. equivalent rotations)
     int number = mApertures.key(aperture, -1);
     if (number < 0) {
         number = mApertures.count() + 10; // 10 is the number of the first aperture
         Q_ASSERT(!mApertures.contains(number));
         mApertures.insert(number, aperture);
     }
+    mApertureNumbers.insert(key, number);
     return number;
 }
 
@@ -72,8 +72,56 @@ class GerberApertureList final
 
     private:
 
+        // Types
+        enum class ApertureShape {Circle, Rect, Obround, RegularPolygon, RotatedRect, RotatedObround};
+
+        /**
+         * @brief Structured identification of an aperture
+         *
+         * Allows looking up existing apertures without generating their textual
+         * definition. All lengths are in nanometers, the rotation in microdegrees.
+         */
+        struct ApertureKey {
+            ApertureShape shape;
+            LengthBase_t size1;
+            LengthBase_t size2;
+            LengthBase_t hole;
+            qint32 rotation;
+            int vertices;
+
+            bool operator==(const ApertureKey& rhs) const noexcept {
+                return (shape == rhs.shape) && (size1 == rhs.size1) && (size2 == rhs.size2) &&
+                       (hole == rhs.hole) && (rotation == rhs.rotation) &&
+                       (vertices == rhs.vertices);
+            }
+            friend uint qHash(const ApertureKey& key, uint seed = 0) noexcept {
+                seed = ::qHash(static_cast<int>(key.shape), seed);
+                seed ^= ::qHash(key.size1, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= ::qHash(key.size2, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= ::qHash(key.hole, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= ::qHash(key.rotation, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= ::qHash(key.vertices, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
         // Private Methods
-        int setCurrentAperture(const QString& aperture) noexcept;
+        static ApertureKey makeKey(ApertureShape shape, const Length& size1,
+                                   const Length& size2, const Length& hole,
+                                   const Angle& rot = Angle(0), int vertices = 0) noexcept;
+
+        /**
+         * @brief Get the number of an aperture, add it if it doesn't exist yet
+         *
+         * @param key       The key to look up the aperture.
+         * @param generate  Callable returning the aperture definition. It is only
+         *                  called if the key is not known yet and may add macros.
+         *
+         * @return The aperture number
+         */
+        template <typename Generator>
+        int addAperture(const ApertureKey& key, Generator generate) noexcept;
+        int insertAperture(const ApertureKey& key, const QString& aperture) noexcept;
         void addMacro(const QString& macro) noexcept;
 
         // Aperture Generator Methods
@@ -91,6 +139,7 @@ class GerberApertureList final
 
         QList<QString> mApertureMacros;
         QMap<int, QString> mApertures; ///< key: aperture number (>= 10); value: aperture definition
+        QHash<ApertureKey, int> mApertureNumbers; ///< value: aperture number in #mApertures
 };
 
 /*****************************************************************************************
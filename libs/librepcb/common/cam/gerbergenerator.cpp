@@ -41,7 +41,8 @@ namespace librepcb {
 GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
                                  const QString& projRevision) noexcept :
     mProjectId(escapeString(projName)), mProjectUuid(projUuid),
-    mProjectRevision(escapeString(projRevision)), mOutput(), mContent(),
+    mProjectRevision(escapeString(projRevision)), mRepeatCountX(1), mRepeatCountY(1),
+    mRepeatStep(0, 0), mOutput(), mContent(),
     mApertureList(new GerberApertureList()), mCurrentApertureNumber(-1),
     mMultiQuadrantArcModeOn(false)
 {
@@ -51,6 +52,19 @@ GerberGenerator::~GerberGenerator() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void GerberGenerator::setStepAndRepeat(int countX, int countY, const Point& step) noexcept
+{
+    Q_ASSERT((countX >= 1) && (countY >= 1));
+    Q_ASSERT((step.getX() >= 0) && (step.getY() >= 0));
+    mRepeatCountX = qMax(countX, 1);
+    mRepeatCountY = qMax(countY, 1);
+    mRepeatStep = step;
+}
+
 /*****************************************************************************************
  *  Plot Methods
  ****************************************************************************************/
@@ -304,7 +318,11 @@ void GerberGenerator::printHeader() noexcept
     mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(appVersion));
     mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
     mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(projId, projUuid, projRevision));
-    mOutput.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
+    if ((mRepeatCountX > 1) || (mRepeatCountY > 1)) {
+        mOutput.append("%TF.Part,Array*%\n"); // "Array" means "this is a panel"
+    } else {
+        mOutput.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
+    }
     //mOutput.append("%TF.FilePolarity,Positive*%\n");
 
     // coordinate format specification:
@@ -332,9 +350,19 @@ void GerberGenerator::printApertureList() noexcept
 
 void GerberGenerator::printContent() noexcept
 {
+    bool stepAndRepeat = (mRepeatCountX > 1) || (mRepeatCountY > 1);
+    if (stepAndRepeat) {
+        mOutput.append(QString("%SRX%1Y%2I%3J%4*%\n").arg(mRepeatCountX).arg(mRepeatCountY)
+                       .arg(mRepeatStep.getX().toMmString(), mRepeatStep.getY().toMmString()));
+        // each copy must start with dark polarity, even if the content ends with clear
+        mOutput.append("%LPD*%\n");
+    }
     mOutput.append("G04 --- BOARD BEGIN --- *\n");
     mOutput.append(mContent);
     mOutput.append("G04 --- BOARD END --- *\n");
+    if (stepAndRepeat) {
+        mOutput.append("%SR*%\n"); // close step and repeat block
+    }
 }
 
 void GerberGenerator::printFooter() noexcept
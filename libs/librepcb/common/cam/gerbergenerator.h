@@ -72,6 +72,23 @@ class GerberGenerator final
         // Getters
         const QString& toStr() const noexcept {return mOutput;}
 
+        // Setters
+
+        /**
+         * @brief Repeat the whole image in a grid of copies (panelization)
+         *
+         * The drawn content is written only once and wrapped in a step and repeat
+         * (%SR) block, so the file size and generation time are independent of the
+         * number of copies. The file is then marked as an array with the X2 attribute
+         * ".Part".
+         *
+         * @param countX    Number of copies in X direction (columns)
+         * @param countY    Number of copies in Y direction (rows)
+         * @param step      Distance between the origins of two neighbouring copies
+         *                  (must not be negative)
+         */
+        void setStepAndRepeat(int countX, int countY, const Point& step) noexcept;
+
         // Plot Methods
         void setLayerPolarity(LayerPolarity p) noexcept;
         void drawLine(const Point& start, const Point& end, const Length& width) noexcept;
@@ -123,6 +140,11 @@ class GerberGenerator final
         Uuid mProjectUuid;
         QString mProjectRevision;
 
+        // Step and Repeat
+        int mRepeatCountX;
+        int mRepeatCountY;
+        Point mRepeatStep;
+
         // Gerber Data
         QString mOutput;
         QString mContent;
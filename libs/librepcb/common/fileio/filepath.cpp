@@ -252,7 +252,10 @@ FilePath FilePath::getApplicationTempPath() noexcept
 
 FilePath FilePath::getRandomTempPath() noexcept
 {
-    QString random = QString("%1_%2").arg(QDateTime::currentMSecsSinceEpoch()).arg(qrand());
+    // qrand() is seeded per thread, so add a counter to get unique paths across threads
+    static QAtomicInt counter;
+    QString random = QString("%1_%2_%3").arg(QDateTime::currentMSecsSinceEpoch())
+                     .arg(qrand()).arg(counter.fetchAndAddOrdered(1));
     return getApplicationTempPath().getPathTo(random);
 }
 
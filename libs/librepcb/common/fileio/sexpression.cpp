@@ -231,6 +231,14 @@ QString SExpression::toString(int indent) const
     }
 }
 
+void SExpression::serializeToBinary(QDataStream& stream) const noexcept
+{
+    stream << static_cast<quint8>(mType) << mValue << static_cast<quint32>(mChildren.count());
+    foreach (const SExpression& child, mChildren) {
+        child.serializeToBinary(stream);
+    }
+}
+
 /*****************************************************************************************
  *  Operator Overloadings
  ****************************************************************************************/
@@ -304,6 +312,110 @@ SExpression SExpression::parse(const QString& str, const FilePath& filePath)
     }
 }
 
+SExpression SExpression::deserializeFromBinary(QDataStream& stream,
+                                              const FilePath& filePath)
+{
+    quint8 type;
+    QString value;
+    quint32 childCount;
+    stream >> type >> value >> childCount;
+    if ((stream.status() != QDataStream::Ok) ||
+        (type > static_cast<quint8>(Type::LineBreak))) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Invalid binary S-Expression "
+            "data of file \"%1\".")).arg(filePath.toNative()));
+    }
+    SExpression node(static_cast<Type>(type), value);
+    node.mFilePath = filePath;
+    for (quint32 i = 0; i < childCount; ++i) {
+        node.mChildren.append(deserializeFromBinary(stream, filePath)); // can throw
+    }
+    return node;
+}
+
+SExpression SExpression::parseTopLevelLists(const QString& str, const FilePath& filePath,
+                                            const QSet<QString>& topLevelLists)
+{
+    // extract the root node name
+    int pos = skipWhitespaces(str, 0);
+    if ((pos >= str.length()) || (str.at(pos) != '(')) {
+        return parse(str, filePath); // invalid, let the parser throw a proper error
+    }
+    int nameStart = skipWhitespaces(str, pos + 1);
+    int nameEnd = findEndOfNode(str, nameStart);
+    if (nameEnd < 0) {
+        return parse(str, filePath);
+    }
+
+    // copy only the requested children of the root node, skip all others
+    QString filtered = "(" % str.mid(nameStart, nameEnd - nameStart);
+    pos = skipWhitespaces(str, nameEnd);
+    while ((pos < str.length()) && (str.at(pos) != ')')) {
+        int end = findEndOfNode(str, pos);
+        if (end < 0) {
+            return parse(str, filePath);
+        }
+        bool keep = true;
+        if (str.at(pos) == '(') {
+            int childNameStart = skipWhitespaces(str, pos + 1);
+            int childNameEnd = findEndOfNode(str, childNameStart);
+            keep = (childNameEnd > childNameStart) &&
+                   topLevelLists.contains(str.mid(childNameStart, childNameEnd - childNameStart));
+        }
+        if (keep) {
+            filtered.append(' ');
+            filtered.append(str.midRef(pos, end - pos));
+        }
+        pos = skipWhitespaces(str, end);
+    }
+    if (pos >= str.length()) {
+        return parse(str, filePath);
+    }
+    filtered.append(')');
+    return parse(filtered, filePath);
+}
+
+/*****************************************************************************************
+ *  Private Static Methods
+ ****************************************************************************************/
+
+int SExpression::skipWhitespaces(const QString& str, int pos) noexcept
+{
+    while ((pos < str.length()) && str.at(pos).isSpace()) {
+        ++pos;
+    }
+    return pos;
+}
+
+int SExpression::findEndOfNode(const QString& str, int pos) noexcept
+{
+    if (pos >= str.length()) {
+        return -1;
+    }
+    int depth = 0;
+    bool inString = false;
+    for (int i = pos; i < str.length(); ++i) {
+        const QChar c = str.at(i);
+        if (inString) {
+            if (c == '\\') {
+                ++i; // skip escaped character
+            } else if (c == '"') {
+                inString = false;
+                if (depth == 0) return i + 1; // end of a string atom
+            }
+        } else if (c == '"') {
+            inString = true;
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')') {
+            if (depth == 0) return i; // end of a token atom (closing parent list)
+            if (--depth == 0) return i + 1; // end of a list
+        } else if ((depth == 0) && c.isSpace()) {
+            return i; // end of a token atom
+        }
+    }
+    return -1;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
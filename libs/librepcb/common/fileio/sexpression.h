@@ -137,6 +137,15 @@ class SExpression final
         void removeLineBreaks() noexcept;
         QString toString(int indent) const;
 
+        /**
+         * @brief Serialize the whole tree into a compact binary representation
+         *
+         * @param stream    The stream to write to
+         *
+         * @see #deserializeFromBinary()
+         */
+        void serializeToBinary(QDataStream& stream) const noexcept;
+
         // Operator Overloadings
         SExpression& operator=(const SExpression& rhs) noexcept;
 
@@ -147,12 +156,46 @@ class SExpression final
         static SExpression createLineBreak();
         static SExpression parse(const QString& str, const FilePath& filePath);
 
+        /**
+         * @brief Deserialize a tree created with #serializeToBinary()
+         *
+         * @param stream    The stream to read from
+         * @param filePath  The file path of the original file (for error messages)
+         *
+         * @return The deserialized tree
+         *
+         * @throws RuntimeError if the stream does not contain a valid tree
+         */
+        static SExpression deserializeFromBinary(QDataStream& stream,
+                                                 const FilePath& filePath);
+
+        /**
+         * @brief Parse only some top-level nodes of an S-Expression
+         *
+         * All other child lists of the root node are skipped on a purely textual level,
+         * i.e. no DOM nodes are created for them at all. This is much faster than
+         * #parse() if only a few (small) nodes of a large document are needed.
+         *
+         * @param str               The S-Expression to parse
+         * @param filePath          The file path (for error messages)
+         * @param topLevelLists     Names of the root's child lists to parse (tokens and
+         *                          strings of the root node are always parsed)
+         *
+         * @return The root node containing only the requested children
+         *
+         * @throws FileParseError if the S-Expression is not valid
+         */
+        static SExpression parseTopLevelLists(const QString& str, const FilePath& filePath,
+                                              const QSet<QString>& topLevelLists);
+
 
     private: // Methods
         SExpression(Type type, const QString& value);
         SExpression(sexpresso::Sexp& sexp, const FilePath& filePath);
 
         QString escapeString(const QString& string) const noexcept;
+        static int skipWhitespaces(const QString& str, int pos) noexcept;
+        static int findEndOfNode(const QString& str, int pos) noexcept;
         bool isValidListName(const QString& name) const noexcept;
         bool isValidToken(const QString& token) const noexcept;
 
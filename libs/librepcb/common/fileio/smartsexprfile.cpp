@@ -52,6 +52,13 @@ SExpression SmartSExprFile::parseFileAndBuildDomTree() const
     return SExpression::parse(FileUtils::readFile(mOpenedFilePath), mOpenedFilePath);
 }
 
+SExpression SmartSExprFile::parseFileAndBuildPartialDomTree(
+    const QSet<QString>& topLevelLists) const
+{
+    return SExpression::parseTopLevelLists(FileUtils::readFile(mOpenedFilePath),
+                                           mOpenedFilePath, topLevelLists);
+}
+
 void SmartSExprFile::save(const SExpression& domDocument, bool toOriginal)
 {
     FilePath filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
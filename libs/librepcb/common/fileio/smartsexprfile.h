@@ -92,6 +92,16 @@ class SmartSExprFile final : public SmartFile
          */
         SExpression parseFileAndBuildDomTree() const;
 
+        /**
+         * @brief Open and parse the S-Expressions file, but build only a partial DOM tree
+         *
+         * @param topLevelLists     Names of the root's child lists to parse, all others
+         *                          are skipped (see SExpression::parseTopLevelLists())
+         *
+         * @return  The partial DOM tree
+         */
+        SExpression parseFileAndBuildPartialDomTree(const QSet<QString>& topLevelLists) const;
+
         /**
          * @brief Write the S-Expressions DOM tree to the file system
          *
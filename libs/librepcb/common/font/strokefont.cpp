@@ -148,16 +148,14 @@ QVector<Path> StrokeFont::strokeLine(const QString& text, const Length& height,
     Length offset = 0;
     width = 0; // same as offset, but without last letter spacing
     for (int i = 0; i < text.length(); ++i) {
-        Length glyphSpacing;
-        QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-        if (!glyphPaths.isEmpty()) {
-            Point bottomLeft, topRight;
-            computeBoundingRect(glyphPaths, bottomLeft, topRight);
-            Length shift = (i == 0) ? -bottomLeft.getX() : 0; // left-align first character
-            foreach (const Path& p, glyphPaths) {
-                paths.append(p.translated(Point(offset + shift, Length(0))));
-            }
-            width = offset + topRight.getX() + shift; // do *not* count glyph spacing as width!
+        Glyph glyph = getGlyph(text.at(i).unicode());
+        Length glyphSpacing = convertLength(height, glyph.spacing);
+        if (!glyph.polylines.isEmpty()) {
+            Length left = convertLength(height, glyph.left);
+            Length right = convertLength(height, glyph.right);
+            Length shift = (i == 0) ? -left : 0; // left-align first character
+            paths += polylines2paths(glyph.polylines, height, offset + shift);
+            width = offset + right + shift; // do *not* count glyph spacing as width!
             offset = width + glyphSpacing + letterSpacing;
         } else if (glyphSpacing != 0) {
             // it's a whitespace-only glyph -> count additional glyph spacing as width
@@ -171,17 +169,9 @@ QVector<Path> StrokeFont::strokeLine(const QString& text, const Length& height,
 QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph, const Length& height,
                                       Length& spacing) const noexcept
 {
-    try {
-        qreal glyphSpacing = 0;
-        QVector<fb::Polyline> polylines = accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                                                            &glyphSpacing); // can throw
-        spacing = convertLength(height, glyphSpacing);
-        return polylines2paths(polylines, height);
-    } catch (const fb::Exception& e) {
-        qWarning() << "Failed to load stroke font glyph" << glyph;
-        spacing = 0;
-        return QVector<Path>();
-    }
+    Glyph g = getGlyph(glyph.unicode());
+    spacing = convertLength(height, g.spacing);
+    return polylines2paths(g.polylines, height);
 }
 
 /*****************************************************************************************
@@ -193,8 +183,60 @@ void StrokeFont::fontLoaded() noexcept
     accessor(); // trigger the message about loading succeeded or failed
 }
 
+StrokeFont::Glyph StrokeFont::getGlyph(uint codePoint) const noexcept
+{
+    {
+        QReadLocker locker(&mGlyphsLock);
+        auto it = mGlyphs.constFind(codePoint);
+        if (it != mGlyphs.constEnd()) {
+            return *it;
+        }
+    }
+
+    // cache miss -> load the glyph (the write lock also serializes accessor usage)
+    QWriteLocker locker(&mGlyphsLock);
+    auto it = mGlyphs.constFind(codePoint);
+    if (it != mGlyphs.constEnd()) {
+        return *it; // loaded by another thread in the meantime
+    }
+    Glyph glyph = loadGlyph(accessor(), codePoint);
+    mGlyphs.insert(codePoint, glyph);
+    return glyph;
+}
+
+StrokeFont::Glyph StrokeFont::loadGlyph(const fb::GlyphListAccessor& accessor,
+                                        uint codePoint) noexcept
+{
+    Glyph glyph;
+    glyph.spacing = 0;
+    glyph.left = 0;
+    glyph.right = 0;
+    try {
+        QVector<fb::Polyline> polylines = accessor.getAllPolylinesOfGlyph(codePoint,
+                                                                          &glyph.spacing); // can throw
+        foreach (const fb::Polyline& p, polylines) {
+            if (!p.isEmpty()) glyph.polylines.append(p);
+        }
+    } catch (const fb::Exception& e) {
+        qWarning() << "Failed to load stroke font glyph" << QChar(codePoint);
+        glyph.spacing = 0;
+        return glyph;
+    }
+
+    // with a height of 9mm, one millimeter corresponds to one font unit
+    if (!glyph.polylines.isEmpty()) {
+        Point bottomLeft, topRight;
+        computeBoundingRect(polylines2paths(glyph.polylines, Length::fromMm(9)),
+                            bottomLeft, topRight);
+        glyph.left = bottomLeft.getX().toMm();
+        glyph.right = topRight.getX().toMm();
+    }
+    return glyph;
+}
+
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept
 {
+    QMutexLocker locker(&mFontMutex);
     if (!mFont) {
         try {
             mFont.reset(new fb::Font(mFuture.result())); // can throw
@@ -217,29 +259,32 @@ const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept
 }
 
 QVector<Path> StrokeFont::polylines2paths(const QVector<fb::Polyline>& polylines,
-                                          const Length& height) noexcept
+                                          const Length& height, const Length& offset) noexcept
 {
     QVector<Path> paths;
+    paths.reserve(polylines.count());
     foreach (const fb::Polyline& p, polylines) {
         if (p.isEmpty()) continue;
-        paths.append(polyline2path(p, height));
+        paths.append(polyline2path(p, height, offset));
     }
     return paths;
 }
 
-Path StrokeFont::polyline2path(const fb::Polyline& p, const Length& height) noexcept
+Path StrokeFont::polyline2path(const fb::Polyline& p, const Length& height,
+                               const Length& offset) noexcept
 {
     Path path;
     foreach (const fb::Vertex& v, p) {
-        path.addVertex(convertVertex(v, height));
+        path.addVertex(convertVertex(v, height, offset));
     }
     return path;
 }
 
-Vertex StrokeFont::convertVertex(const fb::Vertex& v, const Length& height) noexcept
+Vertex StrokeFont::convertVertex(const fb::Vertex& v, const Length& height,
+                                 const Length& offset) noexcept
 {
-    return Vertex(Point::fromMm(v.scaledX(height.toMm()), v.scaledY(height.toMm())),
-                  Angle::fromDeg(v.scaledBulge(180)));
+    Point pos = Point::fromMm(v.scaledX(height.toMm()), v.scaledY(height.toMm()));
+    return Vertex(pos + Point(offset, Length(0)), Angle::fromDeg(v.scaledBulge(180)));
 }
 
 Length StrokeFont::convertLength(const Length& height, qreal length) const noexcept
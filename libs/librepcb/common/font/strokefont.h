@@ -47,6 +47,10 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * The normalized outlines and metrics of every glyph are cached (per font, keyed by
+ * code point) on first use, so stroking texts only has to scale and translate them.
+ * All stroke methods are thread-safe.
  */
 class StrokeFont final : public QObject
 {
@@ -79,13 +83,29 @@ class StrokeFont final : public QObject
         StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
 
+    private: // Types
+        /// Normalized glyph data (in font units, i.e. 9 units = text height)
+        struct Glyph {
+            QVector<fontobene::Polyline> polylines;
+            qreal spacing;  ///< additional glyph spacing
+            qreal left;     ///< left edge of the bounding rect (if not empty)
+            qreal right;    ///< right edge of the bounding rect (if not empty)
+        };
+
+
     private:
         void fontLoaded() noexcept;
+        Glyph getGlyph(uint codePoint) const noexcept;
+        static Glyph loadGlyph(const fontobene::GlyphListAccessor& accessor,
+                               uint codePoint) noexcept;
         const fontobene::GlyphListAccessor& accessor() const noexcept;
         static QVector<Path> polylines2paths(const QVector<fontobene::Polyline>& polylines,
-                                             const Length& height) noexcept;
-        static Path polyline2path(const fontobene::Polyline& p, const Length& height) noexcept;
-        static Vertex convertVertex(const fontobene::Vertex& v, const Length& height) noexcept;
+                                             const Length& height,
+                                             const Length& offset = Length(0)) noexcept;
+        static Path polyline2path(const fontobene::Polyline& p, const Length& height,
+                                  const Length& offset) noexcept;
+        static Vertex convertVertex(const fontobene::Vertex& v, const Length& height,
+                                    const Length& offset) noexcept;
         Length convertLength(const Length& height, qreal length) const noexcept;
         static void computeBoundingRect(const QVector<Path>& paths,
                                         Point& bottomLeft, Point& topRight) noexcept;
@@ -98,6 +118,9 @@ class StrokeFont final : public QObject
         mutable QScopedPointer<fontobene::Font> mFont;
         mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
         mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+        mutable QMutex mFontMutex; ///< protects the font and the fontobene glyph cache
+        mutable QHash<uint, Glyph> mGlyphs; ///< normalized glyph cache
+        mutable QReadWriteLock mGlyphsLock; ///< protects #mGlyphs
 };
 
 /*****************************************************************************************
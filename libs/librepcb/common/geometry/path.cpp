@@ -283,17 +283,11 @@ Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
                    const Length& maxTolerance) noexcept
 {
     // return straight line if radius is smaller than half of the allowed tolerance
-    Length radiusAbs = Toolbox::arcRadius(p1, p2, angle).abs();
-    if (radiusAbs <= maxTolerance.abs() / 2) {
+    int steps = flatArcSteps(p1, p2, angle, maxTolerance);
+    if (steps <= 1) {
         return line(p1, p2);
     }
 
-    // calculate how many lines we need to create
-    qreal radiusAbsNm = static_cast<qreal>(radiusAbs.toNm());
-    qreal y = qBound(0.0, static_cast<qreal>(maxTolerance.toNm()), radiusAbsNm / 4);
-    qreal stepsPerRad = qMin(0.5 / qAcos(1 - y / radiusAbsNm), radiusAbsNm / 2);
-    int steps = qCeil(stepsPerRad * angle.abs().toRad());
-
     // some other very complex calculations...
     qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
     Point center = Toolbox::arcCenter(p1, p2, angle);
@@ -308,6 +302,22 @@ Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
     return p;
 }
 
+int Path::flatArcSteps(const Point& p1, const Point& p2, const Angle& angle,
+                       const Length& maxTolerance) noexcept
+{
+    // straight line if radius is smaller than half of the allowed tolerance
+    Length radiusAbs = Toolbox::arcRadius(p1, p2, angle).abs();
+    if (radiusAbs <= maxTolerance.abs() / 2) {
+        return 1;
+    }
+
+    // calculate how many lines we need to create
+    qreal radiusAbsNm = static_cast<qreal>(radiusAbs.toNm());
+    qreal y = qBound(0.0, static_cast<qreal>(maxTolerance.toNm()), radiusAbsNm / 4);
+    qreal stepsPerRad = qMin(0.5 / qAcos(1 - y / radiusAbsNm), radiusAbsNm / 2);
+    return qCeil(stepsPerRad * angle.abs().toRad());
+}
+
 QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths) noexcept
 {
     QPainterPath p;
@@ -98,6 +98,17 @@ class Path final : public SerializableObject
         static Path octagon(const Length& width, const Length& height) noexcept;
         static Path flatArc(const Point& p1, const Point& p2, const Angle& angle,
                             const Length& maxTolerance) noexcept;
+
+        /**
+         * @brief Get the number of line segments #flatArc() creates for an arc
+         *
+         * Also used by ClipperHelpers to flatten arcs directly into Clipper paths, so
+         * both always create exactly the same points.
+         *
+         * @return The number of line segments (1 means a straight line)
+         */
+        static int flatArcSteps(const Point& p1, const Point& p2, const Angle& angle,
+                                const Length& maxTolerance) noexcept;
         static QPainterPath toQPainterPathPx(const QVector<Path>& paths) noexcept;
 
 
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "stroketext.h"
 #include "../attributes/attributesubstitutor.h"
+#include "../attributes/attributeprovider.h"
 #include "../font/strokefont.h"
 
 /*****************************************************************************************
@@ -316,10 +317,12 @@ void StrokeText::updatePaths() noexcept
 {
     QVector<Path> paths;
     Point center;
+    mUsedAttributes.clear();
     if (mFont) {
         QString str = mText;
         if (mAttributeProvider) {
-            str = AttributeSubstitutor::substitute(str, mAttributeProvider);
+            str = AttributeSubstitutor::substitute(str, mAttributeProvider, nullptr,
+                                                   &mUsedAttributes);
         }
         Point bottomLeft, topRight;
         paths = mFont->stroke(str, mHeight, calcLetterSpacing(), calcLineSpacing(),
@@ -340,6 +343,18 @@ void StrokeText::updatePaths() noexcept
     }
 }
 
+bool StrokeText::updatePathsIfAttributesChanged() noexcept
+{
+    if ((!mFont) || (!mAttributeProvider)) return false;
+    for (auto it = mUsedAttributes.constBegin(); it != mUsedAttributes.constEnd(); ++it) {
+        if (mAttributeProvider->getAttributeValue(it.key()) != it.value()) {
+            updatePaths();
+            return true;
+        }
+    }
+    return false;
+}
+
 void StrokeText::registerObserver(IF_StrokeTextObserver& object) const noexcept
 {
     mObservers.insert(&object);
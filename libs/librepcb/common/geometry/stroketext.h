@@ -191,6 +191,18 @@ class StrokeText final : public SerializableObject
         void setFont(const StrokeFont* font) noexcept;
         const StrokeFont* getCurrentFont() const noexcept {return mFont;}
         void updatePaths() noexcept;
+
+        /**
+         * @brief Update paths only if an attribute used in the text has changed its value
+         *
+         * Attribute providers only notify that *some* attribute has changed, so the
+         * values used by the last #updatePaths() call are compared with the current
+         * values, which is much cheaper than substituting and stroking the text again.
+         *
+         * @return True if the paths were updated, false if nothing has changed
+         */
+        bool updatePathsIfAttributesChanged() noexcept;
+
         void registerObserver(IF_StrokeTextObserver& object) const noexcept;
         void unregisterObserver(IF_StrokeTextObserver& object) const noexcept;
 
@@ -225,6 +237,7 @@ class StrokeText final : public SerializableObject
         mutable QSet<IF_StrokeTextObserver*> mObservers; ///< A list of all observer objects
         const AttributeProvider* mAttributeProvider; ///< for substituting placeholders in text
         const StrokeFont* mFont; ///< font used for calculating paths
+        QHash<QString, QString> mUsedAttributes; ///< attributes used in #updatePaths()
         QVector<Path> mPaths; ///< stroke paths without transformations (mirror/rotate/translate)
         QVector<Path> mPathsRotated; ///< same as #mPaths, but rotated by 180°
 };
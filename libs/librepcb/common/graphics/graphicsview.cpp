@@ -40,10 +40,13 @@ namespace librepcb {
 GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHandler) noexcept :
     QGraphicsView(parent), mEventHandlerObject(eventHandler), mScene(nullptr),
     mZoomAnimation(nullptr), mGridProperties(new GridProperties()), mOriginCrossVisible(true),
-    mUseOpenGl(false), mPanningActive(false)
+    mUseOpenGl(false), mPanningActive(false), mAverageFrameTimeMs(0)
 {
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    // Only repaint the regions which really changed. With FullViewportUpdate, every small
+    // change (e.g. moving the cursor crosshair or a single netline) caused the whole
+    // scene to be redrawn, which is very slow for large boards.
+    setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
     setOptimizationFlags(QGraphicsView::DontSavePainterState);
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -257,6 +260,19 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
     return QWidget::eventFilter(obj, event);
 }
 
+void GraphicsView::paintEvent(QPaintEvent* event)
+{
+    mFrameTimer.start();
+    QGraphicsView::paintEvent(event);
+    qreal frameTimeMs = mFrameTimer.nsecsElapsed() / qreal(1000000);
+    if (mAverageFrameTimeMs > 0) {
+        mAverageFrameTimeMs += sFrameTimeSmoothingFactor * (frameTimeMs - mAverageFrameTimeMs);
+    } else {
+        mAverageFrameTimeMs = frameTimeMs;
+    }
+    emit frameRendered(frameTimeMs, mAverageFrameTimeMs);
+}
+
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
 {
     QPen gridPen(Qt::gray);
@@ -272,7 +288,9 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
     painter->setPen(gridPen);
     painter->setBrush(Qt::NoBrush);
     qreal gridIntervalPixels = mGridProperties->getInterval().toPx();
-    qreal scaleFactor = width() / rect.width();
+    // note: "rect" is only the exposed area, not the whole viewport, so the scale factor
+    // must be taken from the view transformation
+    qreal scaleFactor = qSqrt(qAbs(transform().determinant()));
     if (gridIntervalPixels * scaleFactor >= (qreal)5)
     {
         qreal left, right, top, bottom;
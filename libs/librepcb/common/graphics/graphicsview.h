@@ -59,6 +59,7 @@ class GraphicsView final : public QGraphicsView
         QRectF getVisibleSceneRect() const noexcept;
         bool getUseOpenGl() const noexcept {return mUseOpenGl;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
+        qreal getAverageFrameTimeMs() const noexcept {return mAverageFrameTimeMs;}
 
         // Setters
         void setUseOpenGl(bool useOpenGl) noexcept;
@@ -90,6 +91,17 @@ class GraphicsView final : public QGraphicsView
          */
         void cursorScenePositionChanged(const Point& pos);
 
+        /**
+         * @brief Frame rendered signal
+         *
+         * Emitted after each repaint of the viewport, useful to measure the rendering
+         * performance of the scene.
+         *
+         * @param frameTimeMs           Time needed to render the last frame [ms]
+         * @param averageFrameTimeMs    Smoothed average of the frame times [ms]
+         */
+        void frameRendered(qreal frameTimeMs, qreal averageFrameTimeMs);
+
 
     private slots:
 
@@ -105,6 +117,7 @@ class GraphicsView final : public QGraphicsView
 
         // Inherited Methods
         bool eventFilter(QObject* obj, QEvent* event);
+        void paintEvent(QPaintEvent* event);
         void drawBackground(QPainter* painter, const QRectF& rect);
         void drawForeground(QPainter* painter, const QRectF& rect);
 
@@ -118,9 +131,12 @@ class GraphicsView final : public QGraphicsView
         bool mUseOpenGl;
         volatile bool mPanningActive;
         QCursor mCursorBeforePanning;
+        QElapsedTimer mFrameTimer;
+        qreal mAverageFrameTimeMs;
 
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
+        static constexpr qreal sFrameTimeSmoothingFactor = 0.1;
 };
 
 /*****************************************************************************************
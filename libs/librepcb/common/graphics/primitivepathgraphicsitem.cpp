@@ -164,6 +164,13 @@ void PrimitivePathGraphicsItem::layerDestroyed(const GraphicsLayer& layer) noexc
 void PrimitivePathGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) noexcept
 {
     Q_UNUSED(widget);
+
+    // skip drawing sub-pixel items, they are not visible anyway
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    if (qMax(mBoundingRect.width(), mBoundingRect.height()) * lod < sMinVisibleSizePx) {
+        return;
+    }
+
     if (option->state.testFlag(QStyle::State_Selected)) {
         painter->setPen(mPenHighlighted);
         painter->setBrush(mBrushHighlighted);
@@ -93,6 +93,9 @@ class PrimitivePathGraphicsItem : public QGraphicsItem, public IF_GraphicsLayerO
         QPainterPath mPainterPath;
         QRectF mBoundingRect;
         QPainterPath mShape;
+
+        // Static Variables
+        static constexpr qreal sMinVisibleSizePx = 0.5; ///< smaller items are not drawn
 };
 
 /*****************************************************************************************
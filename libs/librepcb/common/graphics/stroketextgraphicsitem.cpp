@@ -40,7 +40,7 @@ namespace librepcb {
 
 StrokeTextGraphicsItem::StrokeTextGraphicsItem(StrokeText& text,
         const IF_GraphicsLayerProvider& lp, QGraphicsItem* parent) noexcept :
-    PrimitivePathGraphicsItem(parent), mText(text), mLayerProvider(lp)
+    PrimitivePathGraphicsItem(parent), mText(text), mLayerProvider(lp), mLayer(nullptr)
 {
     // add origin cross
     mOriginCrossGraphicsItem.reset(new OriginCrossGraphicsItem(this));
@@ -50,6 +50,7 @@ StrokeTextGraphicsItem::StrokeTextGraphicsItem(StrokeText& text,
     setPosition(mText.getPosition());
     setLineWidth(mText.getStrokeWidth());
     setPath(Path::toQPainterPathPx(mText.getPaths()));
+    mTextRect = PrimitivePathGraphicsItem::boundingRect();
     setFlag(QGraphicsItem::ItemIsSelectable, true);
     setZValue(5);
     updateLayer(mText.getLayerName());
@@ -73,6 +74,19 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept
     return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                                   QWidget* widget) noexcept
+{
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    if (mText.getHeight().toPx() * lod >= sMinReadableHeightPx) {
+        PrimitivePathGraphicsItem::paint(painter, option, widget);
+    } else if (mLayer && mLayer->isVisible() && (!mText.getText().isEmpty())) {
+        // text is too small to be readable, just draw a placeholder rect
+        bool selected = option->state.testFlag(QStyle::State_Selected);
+        painter->fillRect(mTextRect, QBrush(mLayer->getColor(selected), Qt::Dense5Pattern));
+    }
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -144,11 +158,13 @@ void StrokeTextGraphicsItem::strokeTextAutoRotateChanged(bool newAutoRotate) noe
 void StrokeTextGraphicsItem::strokeTextPathsChanged(const QVector<Path>& paths) noexcept
 {
     setPath(Path::toQPainterPathPx(paths));
+    mTextRect = PrimitivePathGraphicsItem::boundingRect();
 }
 
 void StrokeTextGraphicsItem::updateLayer(const QString& layerName) noexcept
 {
     const GraphicsLayer* layer = mLayerProvider.getLayer(layerName);
+    mLayer = layer;
     setLineLayer(layer);
     mOriginCrossGraphicsItem->setLayer(layer);
 }
@@ -35,6 +35,7 @@ namespace librepcb {
 
 class OriginCrossGraphicsItem;
 class IF_GraphicsLayerProvider;
+class GraphicsLayer;
 
 /*****************************************************************************************
  *  Class StrokeTextGraphicsItem
@@ -61,6 +62,8 @@ class StrokeTextGraphicsItem final : public PrimitivePathGraphicsItem,
 
         // Inherited from QGraphicsItem
         QPainterPath shape() const noexcept override;
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                   QWidget* widget = 0) noexcept override;
 
         // Operator Overloadings
         StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
@@ -87,7 +90,12 @@ class StrokeTextGraphicsItem final : public PrimitivePathGraphicsItem,
     private: // Data
         StrokeText& mText;
         const IF_GraphicsLayerProvider& mLayerProvider;
+        const GraphicsLayer* mLayer;
         QScopedPointer<OriginCrossGraphicsItem> mOriginCrossGraphicsItem;
+        QRectF mTextRect;
+
+        // Static Variables
+        static constexpr qreal sMinReadableHeightPx = 3; ///< below: draw text rect only
 };
 
 /*****************************************************************************************
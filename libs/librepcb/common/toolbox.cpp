@@ -54,6 +54,53 @@ QPainterPath Toolbox::shapeFromPath(const QPainterPath &path, const QPen &pen,
     }
 }
 
+QPainterPath Toolbox::simplifiedPath(const QPainterPath& path, qreal tolerance) noexcept
+{
+    QPainterPath simplified;
+    simplified.setFillRule(path.fillRule());
+    const qreal toleranceSq = tolerance * tolerance;
+    foreach (const QPolygonF& polygon, path.toSubpathPolygons()) {
+        QRectF rect = polygon.boundingRect();
+        if ((rect.width() < tolerance) && (rect.height() < tolerance)) {
+            continue; // whole subpath is too small to be visible
+        }
+
+        // Douglas-Peucker: keep the vertex with the largest deviation from the line
+        // between the kept start and end vertex of a range, until all deviations of
+        // the removed vertices are below the tolerance (iterative, no deep recursion)
+        QVector<bool> keep(polygon.count(), false);
+        keep.first() = true;
+        keep.last() = true;
+        QVector<QPair<int, int>> ranges = {qMakePair(0, polygon.count() - 1)};
+        while (!ranges.isEmpty()) {
+            QPair<int, int> range = ranges.takeLast();
+            int farthest = -1;
+            qreal farthestDistanceSq = toleranceSq;
+            for (int i = range.first + 1; i < range.second; ++i) {
+                qreal distanceSq = squaredDistanceToSegment(polygon.at(i),
+                    polygon.at(range.first), polygon.at(range.second));
+                if (distanceSq >= farthestDistanceSq) {
+                    farthest = i;
+                    farthestDistanceSq = distanceSq;
+                }
+            }
+            if (farthest >= 0) {
+                keep[farthest] = true;
+                ranges.append(qMakePair(range.first, farthest));
+                ranges.append(qMakePair(farthest, range.second));
+            }
+        }
+
+        QPolygonF reduced;
+        reduced.reserve(polygon.count());
+        for (int i = 0; i < polygon.count(); ++i) {
+            if (keep.at(i)) reduced.append(polygon.at(i));
+        }
+        simplified.addPolygon(reduced);
+    }
+    return simplified;
+}
+
 Length Toolbox::arcRadius(const Point& p1, const Point& p2, const Angle& a) noexcept
 {
     if (a == 0) {
@@ -119,6 +166,25 @@ Length Toolbox::shortestDistanceBetweenPointAndLine(const Point& p, const Point&
     return (p - np).getLength();
 }
 
+QVector<int> Toolbox::findConnectedNodes(const QVector<QVector<int>>& adjacency,
+                                         int start) noexcept
+{
+    QVector<int> nodes;
+    if ((start < 0) || (start >= adjacency.count())) return nodes;
+    QVector<bool> visited(adjacency.count(), false);
+    visited[start] = true;
+    nodes.append(start);
+    for (int i = 0; i < nodes.count(); ++i) { // note: "nodes" is the BFS queue
+        foreach (int neighbour, adjacency.at(nodes.at(i))) {
+            if (!visited.at(neighbour)) {
+                visited[neighbour] = true;
+                nodes.append(neighbour);
+            }
+        }
+    }
+    return nodes;
+}
+
 QVariant Toolbox::stringOrNumberToQVariant(const QString& string) noexcept
 {
     bool isInt;
@@ -129,6 +195,20 @@ QVariant Toolbox::stringOrNumberToQVariant(const QString& string) noexcept
     return QVariant(string);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+qreal Toolbox::squaredDistanceToSegment(const QPointF& p, const QPointF& l1,
+                                        const QPointF& l2) noexcept
+{
+    QPointF line = l2 - l1;
+    qreal lengthSq = QPointF::dotProduct(line, line);
+    qreal t = (lengthSq > 0) ? QPointF::dotProduct(p - l1, line) / lengthSq : 0;
+    QPointF diff = p - (l1 + line * qBound(qreal(0), t, qreal(1)));
+    return QPointF::dotProduct(diff, diff);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -77,6 +77,23 @@ class Toolbox final
         static QPainterPath shapeFromPath(const QPainterPath &path, const QPen &pen,
                                           const QBrush& brush, const Length& minWidth = Length(0)) noexcept;
 
+        /**
+         * @brief Create a simplified copy of a painter path for low level-of-detail drawing
+         *
+         * All subpaths are flattened to polygons and simplified with the Douglas-Peucker
+         * algorithm, i.e. (nearly) collinear vertices and vertices very close to their
+         * neighbours are removed, while every removed vertex deviates less than the
+         * given tolerance from the simplified polygon. The first and last vertex of each
+         * subpath are kept, so closed subpaths stay closed. Subpaths which are smaller
+         * than the tolerance are dropped completely. The fill rule is preserved.
+         *
+         * @param path          The path to simplify
+         * @param tolerance     Maximum allowed deviation (in the path's coordinate system)
+         *
+         * @return The simplified path
+         */
+        static QPainterPath simplifiedPath(const QPainterPath& path, qreal tolerance) noexcept;
+
         static Length arcRadius(const Point& p1, const Point& p2, const Angle& a) noexcept;
         static Point arcCenter(const Point& p1, const Point& p2, const Angle& a) noexcept;
 
@@ -107,6 +124,22 @@ class Toolbox final
         static Length shortestDistanceBetweenPointAndLine(const Point& p, const Point& l1,
                                                           const Point& l2, Point* nearest = nullptr) noexcept;
 
+        /**
+         * @brief Find all nodes of a graph which are connected to a given node
+         *
+         * Uses an iterative breadth-first search, so the runtime is linear in the number
+         * of nodes and edges and there is no risk of a stack overflow on large graphs.
+         *
+         * @param adjacency     Adjacency list: for each node index the indices of all
+         *                      neighbour nodes
+         * @param start         Index of the node to start with
+         *
+         * @return Indices of all nodes connected to the start node (incl. the start
+         *         node itself), in the order they were reached
+         */
+        static QVector<int> findConnectedNodes(const QVector<QVector<int>>& adjacency,
+                                               int start) noexcept;
+
         /**
          * @brief Convert a numeric or non-numeric string to the corresponding QVariant
          *
@@ -114,6 +147,12 @@ class Toolbox final
          * @return A QVariant with either a QVariant::Int or a QVariant::String
          */
         static QVariant stringOrNumberToQVariant(const QString& string) noexcept;
+
+
+    private:
+
+        static qreal squaredDistanceToSegment(const QPointF& p, const QPointF& l1,
+                                              const QPointF& l2) noexcept;
 };
 
 /*****************************************************************************************
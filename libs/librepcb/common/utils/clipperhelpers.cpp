@@ -22,29 +22,145 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "clipperhelpers.h"
+#include "../toolbox.h"
 
 /*****************************************************************************************
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+static QAtomicInteger<qint64> sConvertedVertices;
+static QAtomicInteger<qint64> sFlattenedArcs;
+static QAtomicInteger<qint64> sCircleCacheHits;
+static QAtomicInteger<qint64> sCircleCacheMisses;
+
+/*****************************************************************************************
+ *  Circle Cache
+ ****************************************************************************************/
+
+// Flattening arcs is not translation-invariant (rounding of the arc center and of the
+// interpolated points), so the center must be part of the key to get exactly the same
+// result as without the cache.
+struct CircleCacheKey {
+    LengthBase_t x;
+    LengthBase_t y;
+    LengthBase_t diameter;
+    LengthBase_t tolerance;
+    bool operator==(const CircleCacheKey& rhs) const noexcept {
+        return (x == rhs.x) && (y == rhs.y) && (diameter == rhs.diameter) &&
+               (tolerance == rhs.tolerance);
+    }
+};
+
+inline uint qHash(const CircleCacheKey& key, uint seed = 0) noexcept {
+    seed = ::qHash(key.x, seed);
+    seed ^= ::qHash(key.y, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= ::qHash(key.diameter, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= ::qHash(key.tolerance, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+static QMutex sCircleCacheMutex;
+static QHash<CircleCacheKey, ClipperLib::Path> sCircleCache;
+static const int sCircleCacheMaxSize = 100000; ///< cleared when exceeded
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void ClipperHelpers::offset(ClipperLib::Paths& paths, const Length& offset,
                             const Length& maxArcTolerance)
+{
+    ClipperLib::ClipperOffset o;
+    ClipperHelpers::offset(o, paths, offset, maxArcTolerance); // can throw
+}
+
+void ClipperHelpers::offset(ClipperLib::ClipperOffset& o, ClipperLib::Paths& paths,
+                            const Length& offset, const Length& maxArcTolerance)
 {
     try {
-        ClipperLib::ClipperOffset o(2.0, maxArcTolerance.toNm());
+        o.Clear();
+        o.MiterLimit = 2.0;
+        o.ArcTolerance = maxArcTolerance.toNm();
         o.AddPaths(paths, ClipperLib::jtRound, ClipperLib::etClosedPolygon);
         o.Execute(paths, offset.toNm());
+        o.Clear();
     } catch (const std::exception& e) {
         throw LogicError(__FILE__, __LINE__,
             QString(tr("Failed to offset a path: %1")).arg(e.what()));
     }
 }
 
+ClipperLib::IntRect ClipperHelpers::getBounds(const ClipperLib::Path& path) noexcept
+{
+    ClipperLib::IntRect rect = {0, 0, 0, 0};
+    if (!path.empty()) {
+        rect.left = rect.right = path.front().X;
+        rect.top = rect.bottom = path.front().Y;
+        for (const ClipperLib::IntPoint& p : path) {
+            rect.left = qMin(rect.left, p.X);
+            rect.right = qMax(rect.right, p.X);
+            rect.top = qMin(rect.top, p.Y);
+            rect.bottom = qMax(rect.bottom, p.Y);
+        }
+    }
+    return rect;
+}
+
+void ClipperHelpers::removeNonIntersecting(ClipperLib::Clipper& c, ClipperLib::Paths& paths,
+                                           const ClipperLib::Paths& areas)
+{
+    // index the areas by their bounding rects, sorted by their left edge
+    QVector<QPair<ClipperLib::IntRect, int>> index;
+    index.reserve(areas.size());
+    for (std::size_t i = 0; i < areas.size(); ++i) {
+        if (areas.at(i).empty()) continue;
+        index.append(qMakePair(getBounds(areas.at(i)), static_cast<int>(i)));
+    }
+    std::sort(index.begin(), index.end(),
+              [](const QPair<ClipperLib::IntRect, int>& a,
+                 const QPair<ClipperLib::IntRect, int>& b)
+              {return a.first.left < b.first.left;});
+
+    // only intersect paths with areas whose bounding rect overlaps the path
+    try {
+        ClipperLib::Paths intersections;
+        paths.erase(std::remove_if(paths.begin(), paths.end(),
+            [&](const ClipperLib::Path& p){
+                ClipperLib::IntRect bounds = getBounds(p);
+                c.Clear();
+                bool candidates = false;
+                for (const QPair<ClipperLib::IntRect, int>& area : index) {
+                    if (area.first.left > bounds.right) break;
+                    if ((area.first.right < bounds.left) ||
+                        (area.first.top > bounds.bottom) ||
+                        (area.first.bottom < bounds.top)) {
+                        continue;
+                    }
+                    c.AddPath(areas.at(area.second), ClipperLib::ptSubject, true);
+                    candidates = true;
+                }
+                if (!candidates) {
+                    return true; // no area nearby -> no intersection
+                }
+                c.AddPath(p, ClipperLib::ptClip, true);
+                c.Execute(ClipperLib::ctIntersection, intersections,
+                          ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+                return intersections.empty();
+            }),
+            paths.end());
+        c.Clear();
+    } catch (const std::exception& e) {
+        c.Clear();
+        throw LogicError(__FILE__, __LINE__,
+            QString(tr("Failed to intersect paths: %1")).arg(e.what()));
+    }
+}
+
 ClipperLib::Paths ClipperHelpers::flattenTree(const ClipperLib::PolyNode& node)
 {
     ClipperLib::Paths paths;
@@ -105,6 +221,7 @@ ClipperLib::Paths ClipperHelpers::convert(const QVector<Path>& paths,
 ClipperLib::Path ClipperHelpers::convert(const Path& path, const Length& maxArcTolerance) noexcept
 {
     ClipperLib::Path p;
+    p.reserve(path.getVertices().count());
     for (int i = 0; i < path.getVertices().count(); ++i) {
         const Vertex& v = path.getVertices().at(i);
         const Vertex& v0 = path.getVertices().at(qMax(i-1, 0));
@@ -112,13 +229,10 @@ ClipperLib::Path ClipperHelpers::convert(const Path& path, const Length& maxArcT
             p.push_back(convert(v.getPos()));
         } else {
             // approximate arcs by many short straight line segments
-            Path arc = Path::flatArc(v0.getPos(), v.getPos(), v0.getAngle(), maxArcTolerance);
-            // skip first point as it is would be a duplicate
-            for (int k = 1; k < arc.getVertices().count(); ++k) {
-                p.push_back(convert(arc.getVertices().at(k).getPos()));
-            }
+            appendFlatArc(p, v0.getPos(), v.getPos(), v0.getAngle(), maxArcTolerance);
         }
     }
+    sConvertedVertices.fetchAndAddRelaxed(p.size());
     // make sure all paths have the same orientation, otherwise we get strange results
     if (!ClipperLib::Orientation(p)) {
         ClipperLib::ReversePath(p);
@@ -131,10 +245,86 @@ ClipperLib::IntPoint ClipperHelpers::convert(const Point& point) noexcept
     return ClipperLib::IntPoint(point.getX().toNm(), point.getY().toNm());
 }
 
+ClipperLib::Path ClipperHelpers::convertCircle(const Point& center, const Length& diameter,
+                                               const Length& maxArcTolerance) noexcept
+{
+    if (diameter <= 0) {
+        return ClipperLib::Path();
+    }
+
+    CircleCacheKey key = {center.getX().toNm(), center.getY().toNm(), diameter.toNm(),
+                          maxArcTolerance.toNm()};
+    {
+        QMutexLocker locker(&sCircleCacheMutex);
+        auto it = sCircleCache.constFind(key);
+        if (it != sCircleCache.constEnd()) {
+            sCircleCacheHits.fetchAndAddRelaxed(1);
+            return *it;
+        }
+    }
+
+    // Note: The circle must be flattened at its final position since the result of
+    // flattening an arc is not translation-invariant, i.e. translating a flattened
+    // circle located at the origin would lead to slightly different vertices.
+    sCircleCacheMisses.fetchAndAddRelaxed(1);
+    ClipperLib::Path circle = convert(Path::circle(diameter).translated(center),
+                                      maxArcTolerance);
+    QMutexLocker locker(&sCircleCacheMutex);
+    if (sCircleCache.count() >= sCircleCacheMaxSize) {
+        sCircleCache.clear();
+    }
+    sCircleCache.insert(key, circle);
+    return circle;
+}
+
+/*****************************************************************************************
+ *  Profiling
+ ****************************************************************************************/
+
+ClipperHelpers::Statistics ClipperHelpers::getStatistics() noexcept
+{
+    Statistics s;
+    s.convertedVertices = sConvertedVertices.load();
+    s.flattenedArcs = sFlattenedArcs.load();
+    s.circleCacheHits = sCircleCacheHits.load();
+    s.circleCacheMisses = sCircleCacheMisses.load();
+    return s;
+}
+
+void ClipperHelpers::resetStatistics() noexcept
+{
+    sConvertedVertices.store(0);
+    sFlattenedArcs.store(0);
+    sCircleCacheHits.store(0);
+    sCircleCacheMisses.store(0);
+}
+
 /*****************************************************************************************
  *  Internal Helper Methods
  ****************************************************************************************/
 
+void ClipperHelpers::appendFlatArc(ClipperLib::Path& path, const Point& p1,
+                                   const Point& p2, const Angle& angle,
+                                   const Length& maxTolerance) noexcept
+{
+    // Same algorithm as Path::flatArc() (the result must be exactly the same!), but
+    // writes the points directly into the Clipper path instead of creating temporary
+    // Path and Vertex objects. The start point is not appended since it is already
+    // the last point of the path.
+    sFlattenedArcs.fetchAndAddRelaxed(1);
+    int steps = Path::flatArcSteps(p1, p2, angle, maxTolerance);
+    if (steps > 1) {
+        qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
+        Point center = Toolbox::arcCenter(p1, p2, angle);
+        path.reserve(path.size() + steps);
+        for (int i = 1; i < steps; ++i) {
+            path.push_back(convert(p1.rotated(Angle(angleDelta * i), center)));
+        }
+    }
+    path.push_back(convert(p2));
+}
+
+
 ClipperLib::Path ClipperHelpers::convertHolesToCutIns(const ClipperLib::Path& outline,
                                                       const ClipperLib::Paths& holes)
 {
@@ -45,6 +45,16 @@ class ClipperHelpers final
 
     public:
 
+        /**
+         * @brief Counters of the conversion methods, useful for profiling
+         */
+        struct Statistics {
+            qint64 convertedVertices;   ///< Clipper points created from librepcb::Path
+            qint64 flattenedArcs;       ///< Arc segments approximated by straight lines
+            qint64 circleCacheHits;     ///< Circles taken from the circle cache
+            qint64 circleCacheMisses;   ///< Circles which had to be flattened
+        };
+
         // Disable instantiation
         ClipperHelpers() = delete;
         ~ClipperHelpers() = delete;
@@ -52,6 +62,24 @@ class ClipperHelpers final
         // General Methods
         static void offset(ClipperLib::Paths& paths, const Length& offset,
                            const Length& maxArcTolerance);
+        static void offset(ClipperLib::ClipperOffset& o, ClipperLib::Paths& paths,
+                           const Length& offset, const Length& maxArcTolerance);
+        static ClipperLib::IntRect getBounds(const ClipperLib::Path& path) noexcept;
+
+        /**
+         * @brief Remove all paths which do not intersect with any of the given areas
+         *
+         * The areas are indexed by their bounding rects, so each path is only
+         * intersected with the areas whose bounding rect overlaps the path's bounding
+         * rect. Paths without any overlapping bounding rect are removed without
+         * calculating the intersection at all.
+         *
+         * @param c         The Clipper object to use (cleared before and after).
+         * @param paths     The paths to filter (e.g. plane fragments).
+         * @param areas     The areas the paths must intersect with to be kept.
+         */
+        static void removeNonIntersecting(ClipperLib::Clipper& c, ClipperLib::Paths& paths,
+                                          const ClipperLib::Paths& areas);
         static ClipperLib::Paths flattenTree(const ClipperLib::PolyNode& node);
 
         // Type Conversions
@@ -64,8 +92,32 @@ class ClipperHelpers final
                                         const Length& maxArcTolerance) noexcept;
         static ClipperLib::IntPoint convert(const Point& point) noexcept;
 
+        /**
+         * @brief Get a flattened circle
+         *
+         * Exactly the same as converting librepcb::Path::circle() translated to the
+         * center with #convert(const Path&, const Length&). The flattened circles are
+         * cached by center, diameter and tolerance, so the many identical holes and
+         * vias which are converted again on every plane rebuild or design rule check
+         * are flattened only once. This method is thread-safe.
+         *
+         * @param center            Center of the circle.
+         * @param diameter          Diameter of the circle.
+         * @param maxArcTolerance   Maximum tolerance when flattening the arcs.
+         *
+         * @return The flattened circle (empty if the diameter is not positive)
+         */
+        static ClipperLib::Path convertCircle(const Point& center, const Length& diameter,
+                                              const Length& maxArcTolerance) noexcept;
+
+        // Profiling
+        static Statistics getStatistics() noexcept;
+        static void resetStatistics() noexcept;
+
 
     private: // Internal Helper Methods
+        static void appendFlatArc(ClipperLib::Path& path, const Point& p1, const Point& p2,
+                                  const Angle& angle, const Length& maxTolerance) noexcept;
         static ClipperLib::Path convertHolesToCutIns(const ClipperLib::Path& outline,
                                                      const ClipperLib::Paths& holes);
         static ClipperLib::Paths prepareHoles(const ClipperLib::Paths& holes) noexcept;
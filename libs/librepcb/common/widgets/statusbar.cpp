@@ -48,6 +48,12 @@ StatusBar::StatusBar(QWidget* parent) noexcept :
     mAbsPosYLabel->setFont(QFont("monospace"));
     addPermanentWidget(mAbsPosYLabel.data());
 
+    // frame time
+    mFrameTimeLabel.reset(new QLabel());
+    mFrameTimeLabel->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
+    mFrameTimeLabel->setFont(QFont("monospace"));
+    addPermanentWidget(mFrameTimeLabel.data());
+
     // progress bar
     mProgressBar.reset(new QProgressBar());
     mProgressBar->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
@@ -66,6 +72,7 @@ StatusBar::StatusBar(QWidget* parent) noexcept :
     setAbsoluteCursorPosition(Point());
     setProgressBarVisible(false);
     setProgressBarPercent(0);
+    setFrameTime(0, 0);
 }
 
 StatusBar::~StatusBar() noexcept
@@ -78,8 +85,10 @@ StatusBar::~StatusBar() noexcept
 
 void StatusBar::setFields(Fields fields) noexcept
 {
+    mFields = fields;
     mAbsPosXLabel->setVisible(fields & AbsolutePosition);
     mAbsPosYLabel->setVisible(fields & AbsolutePosition);
+    mFrameTimeLabel->setVisible(fields & FrameTime);
 }
 
 void StatusBar::setField(Field field, bool enable) noexcept
@@ -98,6 +107,12 @@ void StatusBar::setAbsoluteCursorPosition(const Point& pos) noexcept
     mAbsPosYLabel->setText(QString("Y:%1mm").arg(pos.getY().toMm(), 12, 'f', 6));
 }
 
+void StatusBar::setFrameTime(qreal frameTimeMs, qreal averageFrameTimeMs) noexcept
+{
+    mFrameTimeLabel->setText(QString("Frame:%1ms (avg:%2ms)").arg(frameTimeMs, 6, 'f', 1)
+                             .arg(averageFrameTimeMs, 6, 'f', 1));
+}
+
 void StatusBar::setProgressBarVisible(bool visible) noexcept
 {
     mProgressBar->setVisible(visible);
@@ -51,6 +51,7 @@ class StatusBar final : public QStatusBar
         enum Field {
             AbsolutePosition    = 1<<0,
             ProgressBar         = 1<<1,
+            FrameTime           = 1<<2,
         };
         Q_DECLARE_FLAGS(Fields, Field);
 
@@ -69,6 +70,7 @@ class StatusBar final : public QStatusBar
         void setProgressBarVisible(bool visible) noexcept;
         void setProgressBarTextFormat(const QString& format) noexcept;
         void setProgressBarPercent(int percent) noexcept;
+        void setFrameTime(qreal frameTimeMs, qreal averageFrameTimeMs) noexcept;
 
         // General Methods
         void showProgressBar() noexcept {setProgressBarVisible(true);}
@@ -84,6 +86,7 @@ class StatusBar final : public QStatusBar
         QScopedPointer<QLabel> mAbsPosYLabel;
         QScopedPointer<QProgressBar> mProgressBar;
         QScopedPointer<QWidget> mProgressBarPlaceHolder;
+        QScopedPointer<QLabel> mFrameTimeLabel;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,219 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "batchconverter.h"
+#include "converterdb.h"
+#include "symbolconverter.h"
+#include "packageconverter.h"
+#include "devicesetconverter.h"
+#include "deviceconverter.h"
+#include "polygonsimplifier.h"
+#include <parseagle/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/cmp/component.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BatchConverter::BatchConverter(ConverterDb& db, const FilePath& outputDir) noexcept :
+    QObject(nullptr), mDb(db), mOutputDir(outputDir), mAbort(0), mReadElementsCount(0),
+    mConvertedElementsCount(0)
+{
+}
+
+BatchConverter::~BatchConverter() noexcept
+{
+    mAbort.store(1);
+    mThreadPool.waitForDone();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BatchConverter::convert(Type type, const QList<FilePath>& files) noexcept
+{
+    mAbort.store(0);
+    mReadElementsCount.store(0);
+    mConvertedElementsCount.store(0);
+
+    for (int i = 0; (i < files.count()) && (!mAbort.load()); ++i) {
+        if (files.at(i).isExistingFile()) {
+            convertFile(type, files.at(i), i);
+        } else {
+            emit errorOccurred("File not found: " % files.at(i).toNative());
+        }
+        emit fileFinished(i);
+    }
+    mDb.flush();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BatchConverter::convertFile(Type type, const FilePath& filepath, int fileIndex) noexcept
+{
+    try {
+        parseagle::Library library(filepath.toStr()); // parsed only once, can throw
+        mDb.setCurrentLibraryFilePath(filepath); // no worker threads are running now
+
+        switch (type) {
+            case Type::Symbols:
+                emit fileStarted(fileIndex, library.getSymbols().count());
+                convertElements(library.getSymbols(), [this](const parseagle::Symbol& e){
+                    return convertSymbol(e);});
+                break;
+            case Type::Packages:
+                emit fileStarted(fileIndex, library.getPackages().count());
+                convertElements(library.getPackages(), [this](const parseagle::Package& e){
+                    return convertPackage(e);});
+                break;
+            case Type::DeviceSets:
+                emit fileStarted(fileIndex, library.getDeviceSets().count());
+                convertElements(library.getDeviceSets(), [this](const parseagle::DeviceSet& e){
+                    return convertDeviceSet(e);});
+                break;
+            default:
+                throw LogicError(__FILE__, __LINE__);
+        }
+    } catch (const std::exception& e) {
+        emit errorOccurred(e.what());
+    }
+}
+
+template <typename T, typename Func>
+void BatchConverter::convertElements(const QList<T>& elements, Func func) noexcept
+{
+    QList<QFuture<void>> futures;
+    for (const T& element : elements) {
+        futures.append(QtConcurrent::run(&mThreadPool, [this, &element, func](){
+            if (mAbort.load()) return;
+            bool success = func(element);
+            int read = mReadElementsCount.fetchAndAddOrdered(1) + 1;
+            int converted = success ? (mConvertedElementsCount.fetchAndAddOrdered(1) + 1)
+                                    : mConvertedElementsCount.load();
+            emit elementFinished(converted, read);
+        }));
+    }
+    // wait until all elements are converted since they reference the parsed library
+    for (QFuture<void>& future : futures) {
+        future.waitForFinished();
+    }
+}
+
+bool BatchConverter::convertSymbol(const parseagle::Symbol& symbol) noexcept
+{
+    try {
+        // create symbol
+        SymbolConverter converter(symbol, mDb);
+        std::unique_ptr<Symbol> newSymbol = converter.generate();
+
+        // convert line rects to polygon rects
+        PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+        // save symbol to file
+        newSymbol->saveIntoParentDirectory(mOutputDir.getPathTo("sym"));
+    } catch (const std::exception& e) {
+        emit errorOccurred(e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool BatchConverter::convertPackage(const parseagle::Package& package) noexcept
+{
+    try {
+        // create package
+        PackageConverter converter(package, mDb);
+        std::unique_ptr<Package> newPackage = converter.generate();
+
+        // convert line rects to polygon rects
+        Q_ASSERT(newPackage->getFootprints().count() == 1);
+        PolygonSimplifier<Footprint> polygonSimplifier(*newPackage->getFootprints().first());
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+        // save package to file
+        newPackage->saveIntoParentDirectory(mOutputDir.getPathTo("pkg"));
+    } catch (const std::exception& e) {
+        emit errorOccurred(e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool BatchConverter::convertDeviceSet(const parseagle::DeviceSet& deviceSet) noexcept
+{
+    try {
+        // abort if device name ends with "-US" or "-US_"
+        if (deviceSet.getName().endsWith("-US")) return false;
+        if (deviceSet.getName().endsWith("-US_")) return false;
+
+        // create component
+        DeviceSetConverter converter(deviceSet, mDb);
+        std::unique_ptr<Component> newComponent = converter.generate();
+
+        // create devices
+        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+            if (device.getPackage().isNull()) continue;
+
+            DeviceConverter devConverter(deviceSet, device, mDb);
+            std::unique_ptr<Device> newDevice = devConverter.generate();
+
+            // save device
+            newDevice->saveIntoParentDirectory(mOutputDir.getPathTo("dev"));
+        }
+
+        // save component to file
+        newComponent->saveIntoParentDirectory(mOutputDir.getPathTo("cmp"));
+    } catch (const std::exception& e) {
+        emit errorOccurred(e.what());
+        return false;
+    }
+
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace eagleimport
+} // namespace librepcb
@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EAGLEIMPORT_BATCHCONVERTER_H
+#define LIBREPCB_EAGLEIMPORT_BATCHCONVERTER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace parseagle {
+class Symbol;
+class Package;
+class DeviceSet;
+}
+
+namespace librepcb {
+namespace eagleimport {
+
+class ConverterDb;
+
+/*****************************************************************************************
+ *  Class BatchConverter
+ ****************************************************************************************/
+
+/**
+ * @brief The BatchConverter class converts Eagle libraries into LibrePCB elements
+ *
+ * The converter does not depend on any GUI, so it can also be used headless. Each
+ * *.lbr file is parsed only once, and then all its elements are converted concurrently
+ * in a thread pool. The files are processed one after another because the
+ * librepcb::eagleimport::ConverterDb can only handle one current library at a time.
+ * All accesses to the database are serialized by the database itself.
+ *
+ * The progress is reported by signals, which are emitted from worker threads (so they
+ * should be connected with queued connections to GUI objects).
+ */
+class BatchConverter final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Types
+        enum class Type {
+            Symbols,    ///< symbols to symbols
+            Packages,   ///< packages to packages
+            DeviceSets, ///< device sets to components and devices
+        };
+
+        // Constructors / Destructor
+        BatchConverter() = delete;
+        BatchConverter(const BatchConverter& other) = delete;
+        BatchConverter(ConverterDb& db, const FilePath& outputDir) noexcept;
+        ~BatchConverter() noexcept;
+
+        // Getters
+        int getReadElementsCount() const noexcept {return mReadElementsCount.load();}
+        int getConvertedElementsCount() const noexcept {return mConvertedElementsCount.load();}
+
+        // General Methods
+
+        /**
+         * @brief Convert all elements of the given type of all given files
+         *
+         * This method blocks until all files are converted (or the conversion is
+         * aborted), so it should be called from a worker thread if used from a GUI.
+         *
+         * @param type      The type of elements to convert
+         * @param files     The Eagle library files (*.lbr) to convert
+         */
+        void convert(Type type, const QList<FilePath>& files) noexcept;
+
+        /**
+         * @brief Abort a running conversion (thread-safe)
+         *
+         * Elements already being converted are finished, all others are skipped.
+         */
+        void abort() noexcept {mAbort.store(1);}
+
+        // Operator Overloadings
+        BatchConverter& operator=(const BatchConverter& rhs) = delete;
+
+
+    signals:
+        void fileStarted(int fileIndex, int elementsCount);
+        void elementFinished(int convertedElementsCount, int readElementsCount);
+        void fileFinished(int fileIndex);
+        void errorOccurred(const QString& msg);
+
+
+    private: // Methods
+        void convertFile(Type type, const FilePath& filepath, int fileIndex) noexcept;
+        template <typename T, typename Func>
+        void convertElements(const QList<T>& elements, Func func) noexcept;
+        bool convertSymbol(const parseagle::Symbol& symbol) noexcept;
+        bool convertPackage(const parseagle::Package& package) noexcept;
+        bool convertDeviceSet(const parseagle::DeviceSet& deviceSet) noexcept;
+
+
+    private: // Data
+        ConverterDb& mDb;
+        FilePath mOutputDir;
+        QThreadPool mThreadPool; ///< used to convert the elements of a file concurrently
+        QAtomicInt mAbort;
+        QAtomicInt mReadElementsCount;
+        QAtomicInt mConvertedElementsCount;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace eagleimport
+} // namespace librepcb
+
+#endif // LIBREPCB_EAGLEIMPORT_BATCHCONVERTER_H
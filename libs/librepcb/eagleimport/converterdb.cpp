@@ -36,10 +36,14 @@ namespace eagleimport {
 ConverterDb::ConverterDb(const FilePath& ini) noexcept :
     mIniFile(ini.toStr(), QSettings::IniFormat)
 {
+    foreach (const QString& key, mIniFile.allKeys()) {
+        mValues.insert(key, mIniFile.value(key).toString());
+    }
 }
 
 ConverterDb::~ConverterDb() noexcept
 {
+    flush();
 }
 
 /*****************************************************************************************
@@ -99,6 +103,17 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
     return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+void ConverterDb::flush() noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (mNewKeys.isEmpty()) return;
+    foreach (const QString& key, mNewKeys) {
+        mIniFile.setValue(key, mValues.value(key));
+    }
+    mIniFile.sync();
+    mNewKeys.clear();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -106,27 +121,34 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
 Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
                                   const QString& key2)
 {
-    QString allowedChars("_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-
-    QString settingsKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
-    settingsKey.replace("{", "");
-    settingsKey.replace("}", "");
-    settingsKey.replace(" ", "_");
-    for (int i=0; i<settingsKey.length(); i++)
-    {
-        if (!allowedChars.contains(settingsKey[i]))
-            settingsKey.replace(i, 1, QString("__U%1__").arg(QString::number(settingsKey[i].unicode(), 16).toUpper()));
+    QString rawKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
+    QString settingsKey = cat % '/';
+    settingsKey.reserve(settingsKey.length() + rawKey.length());
+    foreach (const QChar& c, rawKey) {
+        ushort u = c.unicode();
+        if ((u >= '0' && u <= '9') || (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z') ||
+            (u == '_') || (u == '-') || (u == '.')) {
+            settingsKey.append(c);
+        } else if (u == ' ') {
+            settingsKey.append('_');
+        } else if ((u != '{') && (u != '}')) {
+            settingsKey.append(QString("__U%1__").arg(QString::number(u, 16).toUpper()));
+        }
     }
-    settingsKey.prepend(cat % '/');
 
-    Uuid uuid = Uuid::createRandom();
-    QString value = mIniFile.value(settingsKey).toString();
-    if (!value.isEmpty()) uuid = Uuid(value); //Uuid(QString("{%1}").arg(value));
+    QMutexLocker locker(&mMutex);
+    auto it = mValues.constFind(settingsKey);
+    if (it == mValues.constEnd()) {
+        Uuid uuid = Uuid::createRandom();
+        mValues.insert(settingsKey, uuid.toStr());
+        mNewKeys.append(settingsKey);
+        return uuid;
+    }
 
+    Uuid uuid(*it);
     if (uuid.isNull()) {
         throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in *.ini file: " % settingsKey);
     }
-    mIniFile.setValue(settingsKey, uuid.toStr());
     return uuid;
 }
 
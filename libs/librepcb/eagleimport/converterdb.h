@@ -42,6 +42,14 @@ namespace eagleimport {
 
 /**
  * @brief The ConverterDb class
+ *
+ * All mappings of the INI file are loaded into memory once when constructing the
+ * object, and newly created mappings are written back to the INI file in bulk by
+ * #flush() (called by the destructor).
+ *
+ * The UUID getters and #flush() are thread-safe, so elements of the same library can
+ * be converted concurrently. But #setCurrentLibraryFilePath() must not be called while
+ * other threads are accessing the database.
  */
 class ConverterDb final
 {
@@ -67,6 +75,7 @@ class ConverterDb final
         Uuid getSymbolVariantUuid(const Uuid& componentUuid);
         Uuid getSymbolVariantItemUuid(const Uuid& componentUuid, const QString& gateName);
         Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
+        void flush() noexcept;
 
 
         // Operator Overloadings
@@ -79,6 +88,9 @@ class ConverterDb final
 
         QSettings mIniFile;
         FilePath mLibFilePath;
+        QHash<QString, QString> mValues; ///< all values of #mIniFile (key: settings key)
+        QStringList mNewKeys; ///< keys added to #mValues since the last #flush()
+        QMutex mMutex; ///< protects #mValues, #mNewKeys and #mIniFile
 };
 
 /*****************************************************************************************
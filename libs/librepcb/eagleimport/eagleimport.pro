@@ -19,17 +19,21 @@ INCLUDEPATH += \
     ../../parseagle
 
 SOURCES += \
+    batchconverter.cpp \
     converterdb.cpp \
     deviceconverter.cpp \
     devicesetconverter.cpp \
     packageconverter.cpp \
+    polygonsimplifier.cpp \
     symbolconverter.cpp \
 
 HEADERS += \
+    batchconverter.h \
     converterdb.h \
     deviceconverter.h \
     devicesetconverter.h \
     packageconverter.h \
+    polygonsimplifier.h \
     symbolconverter.h \
 
 FORMS += \
@@ -151,24 +151,7 @@ void Library::removeDependency(const Uuid& uuid) noexcept
 template <typename ElementType>
 QList<FilePath> Library::searchForElements() const noexcept
 {
-    QList<FilePath> list;
-    FilePath subDirFilePath = getElementsDirectory<ElementType>();
-    QDir subDir(subDirFilePath.toStr());
-    foreach (const QString& dirname, subDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
-        FilePath elementFilePath = subDirFilePath.getPathTo(dirname);
-        if (isValidElementDirectory<ElementType>(elementFilePath)) {
-            list.append(elementFilePath);
-        } else if (elementFilePath.isEmptyDir()) {
-            qInfo() << "Empty library element directory will be removed:" << elementFilePath.toNative();
-            // TODO: This is actually a race condition, because the directory may be
-            // created just a moment ago in the main thread, and is thus still empty.
-            // Even if not very critical, this should be made thread-safe some time ;)
-            QDir(elementFilePath.toStr()).removeRecursively();
-        } else {
-            qWarning() << "Directory is not a valid library element:" << elementFilePath.toNative();
-        }
-    }
-    return list;
+    return searchForElements(ElementType::getShortElementName());
 }
 
 // explicit template instantiations
@@ -179,10 +162,80 @@ template QList<FilePath> Library::searchForElements<Package>() const noexcept;
 template QList<FilePath> Library::searchForElements<Component>() const noexcept;
 template QList<FilePath> Library::searchForElements<Device>() const noexcept;
 
+QHash<QString, QList<FilePath>> Library::searchForAllElements() const noexcept
+{
+    // Only the known "<library>/<type>" directories are listed (one level deep, not
+    // recursively), so the content of the element directories and of other directories
+    // (e.g. ".git") is never read.
+    const QStringList shortElementNames = {
+        ComponentCategory::getShortElementName(), PackageCategory::getShortElementName(),
+        Symbol::getShortElementName(), Package::getShortElementName(),
+        Component::getShortElementName(), Device::getShortElementName()};
+    QHash<QString, QList<FilePath>> elements;
+    foreach (const QString& shortElementName, shortElementNames) {
+        elements.insert(shortElementName, searchForElements(shortElementName));
+    }
+    return elements;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+QList<FilePath> Library::searchForElements(const QString& shortElementName) const noexcept
+{
+    // Iterate over plain path strings and check the version files directly, which
+    // avoids creating (and normalizing) a FilePath object for each directory entry.
+    // Only valid elements are converted to FilePath objects.
+    QStringList dirPaths;
+    QDirIterator it(mDirectory.getPathTo(shortElementName).toStr(),
+                    QDir::Dirs | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        QString dirPath = it.next();
+        if (isValidElementDirectory(dirPath, shortElementName)) {
+            dirPaths.append(dirPath);
+        } else if (isEmptyDirectory(dirPath)) {
+            removeEmptyElementDirectory(dirPath);
+        } else {
+            qWarning() << "Directory is not a valid library element:"
+                       << QDir::toNativeSeparators(dirPath);
+        }
+    }
+    return toSortedFilePaths(dirPaths);
+}
+
+bool Library::isValidElementDirectory(const QString& dirPath,
+                                      const QString& shortElementName) noexcept
+{
+    return QFileInfo(dirPath % "/.librepcb-" % shortElementName).isFile();
+}
+
+bool Library::isEmptyDirectory(const QString& dirPath) noexcept
+{
+    return QDir(dirPath, QString(), QDir::NoSort,
+                QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden).count() == 0;
+}
+
+void Library::removeEmptyElementDirectory(const QString& dirPath) noexcept
+{
+    qInfo() << "Empty library element directory will be removed:"
+            << QDir::toNativeSeparators(dirPath);
+    // TODO: This is actually a race condition, because the directory may be
+    // created just a moment ago in the main thread, and is thus still empty.
+    // Even if not very critical, this should be made thread-safe some time ;)
+    QDir(dirPath).removeRecursively();
+}
+
+QList<FilePath> Library::toSortedFilePaths(QStringList dirPaths) noexcept
+{
+    dirPaths.sort(); // make the result independent of the file system order
+    QList<FilePath> list;
+    foreach (const QString& dirPath, dirPaths) {
+        list.append(FilePath(dirPath));
+    }
+    return list;
+}
+
 void Library::copyTo(const FilePath& destination, bool removeSource)
 {
     // check directory suffix
@@ -78,6 +78,18 @@ class Library final : public LibraryBaseElement
         template <typename ElementType>
         QList<FilePath> searchForElements() const noexcept;
 
+        /**
+         * @brief Search for the elements of all types
+         *
+         * Lists only the element type directories (e.g. "sym"), one level deep, so the
+         * content of the element directories is never read. Empty element directories
+         * are removed, as done by #searchForElements().
+         *
+         * @return Directories of all valid elements (sorted by path), with the short
+         *         element name (e.g. "sym" or "pkg") as key
+         */
+        QHash<QString, QList<FilePath>> searchForAllElements() const noexcept;
+
         // Operator Overloadings
         Library& operator=(const Library& rhs) = delete;
 
@@ -89,6 +101,12 @@ class Library final : public LibraryBaseElement
     private: // Methods
 
         // Private Methods
+        QList<FilePath> searchForElements(const QString& shortElementName) const noexcept;
+        static bool isValidElementDirectory(const QString& dirPath,
+                                            const QString& shortElementName) noexcept;
+        static bool isEmptyDirectory(const QString& dirPath) noexcept;
+        static void removeEmptyElementDirectory(const QString& dirPath) noexcept;
+        static QList<FilePath> toSortedFilePaths(QStringList dirPaths) noexcept;
         virtual void copyTo(const FilePath& destination, bool removeSource) override;
         /// @copydoc librepcb::SerializableObject::serialize()
         virtual void serialize(SExpression& root) const override;
@@ -35,6 +35,7 @@ SOURCES += \
     dev/devicepadsignalmap.cpp \
     library.cpp \
     librarybaseelement.cpp \
+    librarysnapshot.cpp \
     libraryelement.cpp \
     pkg/cmd/cmdfootprintedit.cpp \
     pkg/cmd/cmdfootprintpadedit.cpp \
@@ -74,6 +75,7 @@ HEADERS += \
     elements.h \
     library.h \
     librarybaseelement.h \
+    librarysnapshot.h \
     libraryelement.h \
     pkg/cmd/cmdfootprintedit.h \
     pkg/cmd/cmdfootprintpadedit.h \
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "librarybaseelement.h"
+#include "librarysnapshot.h"
 #include <librepcb/common/fileio/smartversionfile.h>
 #include <librepcb/common/fileio/smartsexprfile.h>
 #include <librepcb/common/fileio/sexpression.h>
@@ -45,7 +46,7 @@ LibraryBaseElement::LibraryBaseElement(bool dirnameMustBeUuid, const QString& sh
                                        const QString& description_en_US,
                                        const QString& keywords_en_US) :
     QObject(nullptr), mDirectory(FilePath::getRandomTempPath()),
-    mDirectoryIsTemporary(true), mOpenedReadOnly(false),
+    mDirectoryIsTemporary(true), mOpenedReadOnly(false), mOpenedMetadataOnly(false),
     mDirectoryNameMustBeUuid(dirnameMustBeUuid),
     mShortElementName(shortElementName), mLongElementName(longElementName),
     mUuid(uuid), mVersion(version), mAuthor(author),
@@ -61,9 +62,11 @@ LibraryBaseElement::LibraryBaseElement(bool dirnameMustBeUuid, const QString& sh
 LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
                                        bool dirnameMustBeUuid,
                                        const QString& shortElementName,
-                                       const QString& longElementName, bool readOnly) :
+                                       const QString& longElementName, bool readOnly,
+                                       bool metadataOnly) :
     QObject(nullptr), mDirectory(elementDirectory),mDirectoryIsTemporary(false),
-    mOpenedReadOnly(readOnly), mDirectoryNameMustBeUuid(dirnameMustBeUuid),
+    mOpenedReadOnly(readOnly || metadataOnly), mOpenedMetadataOnly(metadataOnly),
+    mDirectoryNameMustBeUuid(dirnameMustBeUuid),
     mShortElementName(shortElementName), mLongElementName(longElementName)
 {
     // determine the filepath to the version file
@@ -94,10 +97,20 @@ LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
             .arg(mDirectory.toNative()).arg(mLoadingElementFileVersion.toPrettyStr(3)));
     }
 
-    // open main file
+    // open main file (or take its DOM tree from the library snapshot if up to date)
     FilePath sexprFilePath = mDirectory.getPathTo(mLongElementName % ".lp");
-    SmartSExprFile sexprFile(sexprFilePath, false, true);
-    mLoadingFileDocument = sexprFile.parseFileAndBuildDomTree();
+    LibrarySnapshot* snapshot = LibrarySnapshot::getGlobalInstance();
+    if ((!snapshot) || (!snapshot->tryLoad(sexprFilePath, mLoadingFileDocument))) {
+        SmartSExprFile sexprFile(sexprFilePath, false, true);
+        if (mOpenedMetadataOnly) {
+            // skip all the (possibly large) non-metadata nodes like geometry
+            mLoadingFileDocument = sexprFile.parseFileAndBuildPartialDomTree(
+                getMetadataNodeNames()); // can throw
+        } else {
+            mLoadingFileDocument = sexprFile.parseFileAndBuildDomTree(); // can throw
+            if (snapshot) snapshot->insert(sexprFilePath, mLoadingFileDocument);
+        }
+    }
 
     // read attributes
     if (mLoadingFileDocument.getChildByIndex(0).isString()) {
@@ -149,6 +162,16 @@ QStringList LibraryBaseElement::getAllAvailableLocales() const noexcept
     return list;
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QSet<QString> LibraryBaseElement::getMetadataNodeNames() noexcept
+{
+    return QSet<QString>{"uuid", "version", "author", "created", "deprecated", "name",
+                         "description", "keywords", "category", "parent"};
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -209,6 +232,11 @@ void LibraryBaseElement::cleanupAfterLoadingElementFromFile() noexcept
 
 void LibraryBaseElement::copyTo(const FilePath& destination, bool removeSource)
 {
+    if (mOpenedMetadataOnly) {
+        // saving would drop all the content which was not loaded
+        throw LogicError(__FILE__, __LINE__);
+    }
+
     if (destination != mDirectory) {
         // check destination directory name validity
         if (mDirectoryNameMustBeUuid && (destination.getFilename() != mUuid.toStr())) {
@@ -61,12 +61,13 @@ class LibraryBaseElement : public QObject, public SerializableObject
                            const QString& keywords_en_US);
         LibraryBaseElement(const FilePath& elementDirectory, bool dirnameMustBeUuid,
                            const QString& shortElementName, const QString& longElementName,
-                           bool readOnly);
+                           bool readOnly, bool metadataOnly = false);
         virtual ~LibraryBaseElement() noexcept;
 
         // Getters: General
         const FilePath& getFilePath() const noexcept {return mDirectory;}
         bool isOpenedReadOnly() const noexcept {return mOpenedReadOnly;}
+        bool isOpenedMetadataOnly() const noexcept {return mOpenedMetadataOnly;}
 
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
@@ -102,6 +103,16 @@ class LibraryBaseElement : public QObject, public SerializableObject
         static bool isValidElementDirectory(const FilePath& dir) noexcept
         {return dir.getPathTo(".librepcb-" % ElementType::getShortElementName()).isExistingFile();}
 
+        /**
+         * @brief Get the names of all metadata nodes of library element files
+         *
+         * These are the only nodes parsed if an element is opened in metadata-only mode
+         * (UUID, version, author, names, descriptions, keywords, categories, ...).
+         *
+         * @return Names of all top-level nodes which contain metadata
+         */
+        static QSet<QString> getMetadataNodeNames() noexcept;
+
 
     protected:
 
@@ -118,6 +129,7 @@ class LibraryBaseElement : public QObject, public SerializableObject
         mutable FilePath mDirectory;
         mutable bool mDirectoryIsTemporary;
         bool mOpenedReadOnly;
+        bool mOpenedMetadataOnly; ///< only metadata loaded, element can't be saved
         bool mDirectoryNameMustBeUuid;
         QString mShortElementName; ///< e.g. "lib", "cmpcat", "sym"
         QString mLongElementName; ///< e.g. "library", "component_category", "symbol"
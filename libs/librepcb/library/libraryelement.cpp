@@ -46,13 +46,21 @@ LibraryElement::LibraryElement(const QString& shortElementName,
 }
 
 LibraryElement::LibraryElement(const FilePath& elementDirectory, const QString& shortElementName,
-                               const QString& longElementName, bool readOnly) :
-    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly)
+                               const QString& longElementName, bool readOnly,
+                               bool metadataOnly) :
+    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly,
+                       metadataOnly)
 {
     // read category UUIDs
     foreach (const SExpression& node, mLoadingFileDocument.getChildren("category")) {
         mCategories.insert(node.getValueOfFirstChild<Uuid>(true));
     }
+
+    // metadata-only elements are not loaded any further by subclasses (they are opened
+    // as plain LibraryElement objects), so the DOM tree is not needed anymore
+    if (metadataOnly) {
+        cleanupAfterLoadingElementFromFile();
+    }
 }
 
 LibraryElement::~LibraryElement() noexcept
@@ -53,8 +53,22 @@ class LibraryElement : public LibraryBaseElement
                        const Uuid& uuid, const Version& version, const QString& author,
                        const QString& name_en_US, const QString& description_en_US,
                        const QString& keywords_en_US);
+
+        /**
+         * @brief Open a library element from a directory
+         *
+         * @param elementDirectory  The element directory
+         * @param shortElementName  e.g. "sym"
+         * @param longElementName   e.g. "symbol"
+         * @param readOnly          Whether the element is opened read-only or not
+         * @param metadataOnly      If true, only the metadata is loaded (implies read-only)
+         *                          and the parsed file is released right away. Only
+         *                          allowed for plain LibraryElement objects, not for
+         *                          subclasses which need to load more content.
+         */
         LibraryElement(const FilePath& elementDirectory, const QString& shortElementName,
-                       const QString& longElementName, bool readOnly);
+                       const QString& longElementName, bool readOnly,
+                       bool metadataOnly = false);
         virtual ~LibraryElement() noexcept;
 
         // Getters: Attributes
@@ -0,0 +1,291 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "librarysnapshot.h"
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/application.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+QAtomicPointer<LibrarySnapshot> LibrarySnapshot::sGlobalInstance;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+LibrarySnapshot::LibrarySnapshot(const FilePath& filepath, const FilePath& rootDir) noexcept :
+    mFilePath(filepath), mRootDir(rootDir), mMappedData(nullptr), mModified(false)
+{
+    load();
+}
+
+LibrarySnapshot::~LibrarySnapshot() noexcept
+{
+    sGlobalInstance.testAndSetOrdered(this, nullptr);
+    unload();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+int LibrarySnapshot::getEntriesCount() const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    return mEntries.count();
+}
+
+bool LibrarySnapshot::isModified() const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    return mModified;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool LibrarySnapshot::tryLoad(const FilePath& filepath, SExpression& dom) const noexcept
+{
+    qint64 size;
+    QByteArray hash;
+    if (!getFileStamp(filepath, size, hash)) {
+        return false;
+    }
+
+    // note: keep the mutex locked while deserializing as the data may point into the
+    // mapped file, which gets unmapped by save()
+    QMutexLocker locker(&mMutex);
+    auto it = mEntries.constFind(filepath.toStr());
+    if (it == mEntries.constEnd()) {
+        return false;
+    }
+    if ((size != it->size) || (hash != it->hash)) {
+        return false; // the file was modified since the snapshot was taken
+    }
+
+    try {
+        QDataStream stream(it->data);
+        stream.setVersion(QDataStream::Qt_5_2);
+        dom = SExpression::deserializeFromBinary(stream, filepath); // can throw
+        return true;
+    } catch (const Exception& e) {
+        qWarning() << "Failed to load" << filepath.toNative() << "from library snapshot:"
+                   << e.getMsg();
+        return false;
+    }
+}
+
+void LibrarySnapshot::insert(const FilePath& filepath, const SExpression& dom) noexcept
+{
+    Entry entry;
+    if (!getFileStamp(filepath, entry.size, entry.hash)) {
+        return;
+    }
+    QDataStream stream(&entry.data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_2);
+    dom.serializeToBinary(stream);
+
+    QMutexLocker locker(&mMutex);
+    mEntries.insert(filepath.toStr(), entry);
+    mModified = true;
+}
+
+void LibrarySnapshot::save()
+{
+    QMutexLocker locker(&mMutex);
+
+    // remove entries of removed files
+    for (auto it = mEntries.begin(); it != mEntries.end();) {
+        if (!QFileInfo(it.key()).isFile()) {
+            it = mEntries.erase(it);
+            mModified = true;
+        } else {
+            ++it;
+        }
+    }
+    if (!mModified) {
+        return;
+    }
+
+    // build the index and the data section
+    QByteArray content;
+    QByteArray data;
+    QDataStream stream(&content, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_2);
+    stream << sMagicNumber << sFormatVersion << qApp->getAppVersion().toStr()
+           << static_cast<quint32>(mEntries.count());
+    for (auto it = mEntries.constBegin(); it != mEntries.constEnd(); ++it) {
+        stream << it.key() << it->size << it->hash << static_cast<qint64>(data.size())
+               << static_cast<qint64>(it->data.size());
+        data.append(it->data);
+    }
+    content.append(data);
+
+    // the mapped file must be closed before it can be overwritten
+    unload();
+    try {
+        FileUtils::writeFile(mFilePath, content); // can throw
+    } catch (const Exception& e) {
+        load(); // try to restore the previous snapshot
+        throw;
+    }
+    load();
+    qDebug() << "Saved library snapshot with" << mEntries.count() << "entries.";
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+LibrarySnapshot* LibrarySnapshot::getGlobalInstance() noexcept
+{
+    return sGlobalInstance.loadAcquire();
+}
+
+void LibrarySnapshot::setGlobalInstance(LibrarySnapshot* snapshot) noexcept
+{
+    sGlobalInstance.storeRelease(snapshot);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void LibrarySnapshot::load() noexcept
+{
+    // note: called with locked mutex (or from the constructor)
+    unload();
+    if (!mFilePath.isExistingFile()) {
+        return;
+    }
+
+    // map the file into memory (read it as fallback)
+    mFile.setFileName(mFilePath.toStr());
+    if (!mFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open library snapshot:" << mFilePath.toNative();
+        return;
+    }
+    QByteArray raw;
+    mMappedData = mFile.map(0, mFile.size());
+    if (mMappedData) {
+        raw = QByteArray::fromRawData(reinterpret_cast<const char*>(mMappedData),
+                                      mFile.size());
+    } else {
+        mFileContent = mFile.readAll();
+        raw = mFileContent;
+    }
+
+    // read and check the header
+    QDataStream stream(raw);
+    stream.setVersion(QDataStream::Qt_5_2);
+    quint32 magicNumber, formatVersion, count;
+    QString appVersion;
+    stream >> magicNumber >> formatVersion >> appVersion >> count;
+    if ((stream.status() != QDataStream::Ok) || (magicNumber != sMagicNumber) ||
+        (formatVersion != sFormatVersion) || (appVersion != qApp->getAppVersion().toStr())) {
+        qInfo() << "Ignoring invalid or outdated library snapshot:" << mFilePath.toNative();
+        unload();
+        return;
+    }
+
+    // read the index
+    QVector<QPair<QString, Entry>> entries;
+    QVector<QPair<qint64, qint64>> ranges;
+    for (quint32 i = 0; (i < count) && (stream.status() == QDataStream::Ok); ++i) {
+        QString path;
+        Entry entry;
+        qint64 offset, length;
+        stream >> path >> entry.size >> entry.hash >> offset >> length;
+        entries.append(qMakePair(path, entry));
+        ranges.append(qMakePair(offset, length));
+    }
+    qint64 dataStart = stream.device()->pos();
+    if (stream.status() != QDataStream::Ok) {
+        qWarning() << "Ignoring corrupt library snapshot:" << mFilePath.toNative();
+        unload();
+        return;
+    }
+
+    // reference the data of all entries directly in the mapped memory
+    for (int i = 0; i < entries.count(); ++i) {
+        qint64 offset = ranges.at(i).first;
+        qint64 length = ranges.at(i).second;
+        if ((offset < 0) || (length < 0) || (dataStart + offset + length > raw.size())) {
+            qWarning() << "Ignoring corrupt library snapshot:" << mFilePath.toNative();
+            unload();
+            return;
+        }
+        Entry& entry = entries[i].second;
+        entry.data = QByteArray::fromRawData(raw.constData() + dataStart + offset, length);
+        mEntries.insert(entries.at(i).first, entry);
+    }
+    mModified = false;
+}
+
+void LibrarySnapshot::unload() noexcept
+{
+    // note: called with locked mutex (or from the constructor/destructor)
+    mEntries.clear(); // must be cleared first as the entries reference the mapped memory
+    if (mMappedData) {
+        mFile.unmap(mMappedData);
+        mMappedData = nullptr;
+    }
+    mFile.close();
+    mFileContent.clear();
+}
+
+bool LibrarySnapshot::getFileStamp(const FilePath& filepath, qint64& size,
+                                   QByteArray& hash) const noexcept
+{
+    if (!filepath.isLocatedInDir(mRootDir)) {
+        return false;
+    }
+    QFile file(filepath.toStr());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QCryptographicHash hasher(QCryptographicHash::Sha1);
+    if (!hasher.addData(&file)) {
+        return false;
+    }
+    size = file.size();
+    hash = hasher.result();
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
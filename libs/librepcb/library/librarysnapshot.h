@@ -0,0 +1,163 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYSNAPSHOT_H
+#define LIBREPCB_LIBRARY_LIBRARYSNAPSHOT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class SExpression;
+
+namespace library {
+
+/*****************************************************************************************
+ *  Class LibrarySnapshot
+ ****************************************************************************************/
+
+/**
+ * @brief The LibrarySnapshot class is a binary cache of parsed library element files
+ *
+ * Parsing the S-Expression files of thousands of library elements takes a lot of time,
+ * so the parsed DOM trees can be stored in a compact binary snapshot file. The file is
+ * memory-mapped when opened, and trees are deserialized directly from the mapped memory
+ * on demand.
+ *
+ * Only files located in the root directory passed to the constructor (i.e. the
+ * workspace libraries) are cached, all other files (e.g. project library elements) are
+ * always parsed.
+ *
+ * Every entry stores the size and a SHA-1 hash of the content of its source file. An
+ * entry is only used if they are still the same, otherwise the source file is parsed
+ * again. Modification times are not used because their resolution is too coarse on
+ * some file systems to detect modifications reliably. The whole snapshot is discarded
+ * if it was written by another application version or with another snapshot format
+ * version, or if it is corrupt.
+ *
+ * If a global snapshot is installed with #setGlobalInstance(), all
+ * librepcb::library::LibraryBaseElement objects load from and store into it.
+ *
+ * @note All methods are thread-safe.
+ */
+class LibrarySnapshot final
+{
+        Q_DECLARE_TR_FUNCTIONS(LibrarySnapshot)
+
+    public:
+
+        // Constructors / Destructor
+        LibrarySnapshot() = delete;
+        LibrarySnapshot(const LibrarySnapshot& other) = delete;
+        LibrarySnapshot(const FilePath& filepath, const FilePath& rootDir) noexcept;
+        ~LibrarySnapshot() noexcept;
+
+        // Getters
+        const FilePath& getFilePath() const noexcept {return mFilePath;}
+        const FilePath& getRootDir() const noexcept {return mRootDir;}
+        int getEntriesCount() const noexcept;
+        bool isModified() const noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Load the DOM tree of a file from the snapshot (if it is up to date)
+         *
+         * @param filepath  The S-Expression file to load
+         * @param dom       The DOM tree will be written into this variable
+         *
+         * @retval true     If the DOM tree was loaded from the snapshot
+         * @retval false    If there is no up to date entry for the file, or the file is
+         *                  not located in the root directory
+         */
+        bool tryLoad(const FilePath& filepath, SExpression& dom) const noexcept;
+
+        /**
+         * @brief Add (or replace) the DOM tree of a file
+         *
+         * Does nothing if the file is not located in the root directory.
+         *
+         * @param filepath  The parsed S-Expression file
+         * @param dom       The DOM tree of the whole file
+         */
+        void insert(const FilePath& filepath, const SExpression& dom) noexcept;
+
+        /**
+         * @brief Write the snapshot to the file system (if it was modified)
+         *
+         * Entries of no longer existing files are removed. Entries of modified files
+         * are kept until they are replaced by #insert(), they are never used anyway.
+         *
+         * @throws Exception if the file could not be written
+         */
+        void save();
+
+        // Operator Overloadings
+        LibrarySnapshot& operator=(const LibrarySnapshot& rhs) = delete;
+
+        // Static Methods
+        static LibrarySnapshot* getGlobalInstance() noexcept;
+        static void setGlobalInstance(LibrarySnapshot* snapshot) noexcept;
+
+
+    private: // Types
+        struct Entry {
+            qint64 size;        ///< size of the file [bytes]
+            QByteArray hash;    ///< SHA-1 hash of the file content
+            QByteArray data;    ///< binary DOM tree (may point into the mapped file!)
+        };
+
+
+    private: // Methods
+        void load() noexcept;
+        void unload() noexcept;
+        bool getFileStamp(const FilePath& filepath, qint64& size,
+                          QByteArray& hash) const noexcept;
+
+
+    private: // Data
+        mutable QMutex mMutex;
+        FilePath mFilePath;
+        FilePath mRootDir;
+        QFile mFile;
+        uchar* mMappedData; ///< the mapped snapshot file, or nullptr if not mapped
+        QByteArray mFileContent; ///< the snapshot file content if it could not be mapped
+        QHash<QString, Entry> mEntries; ///< key: absolute file path
+        bool mModified;
+
+        static QAtomicPointer<LibrarySnapshot> sGlobalInstance;
+        static constexpr quint32 sMagicNumber = 0x4C504C53; // "LPLS"
+        static constexpr quint32 sFormatVersion = 2;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_LIBRARYSNAPSHOT_H
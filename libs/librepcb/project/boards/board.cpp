@@ -57,6 +57,8 @@
 #include "boardusersettings.h"
 #include "boardselectionquery.h"
 #include "boardairwiresbuilder.h"
+#include "boardgeometrycache.h"
+#include "boarddesignrulecheck.h"
 #include "../circuit/netsignal.h"
 
 /*****************************************************************************************
@@ -71,11 +73,13 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mHasGraphicsItems(false)
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mGeometryCache.reset(new BoardGeometryCache());
+        mDesignRuleCheck.reset(new BoardDesignRuleCheck(*this));
 
         // copy the other board
         mFile.reset(SmartSExprFile::create(mFilePath));
@@ -143,7 +147,6 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
         // rebuildAllPlanes(); --> fragments are copied too, so no need to rebuild them
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
@@ -177,11 +180,14 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
 Board::Board(Project& project, const FilePath& filepath, bool restore,
              bool readOnly, bool create, const QString& newName) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false),
+    mHasGraphicsItems(false)
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mGeometryCache.reset(new BoardGeometryCache());
+        mDesignRuleCheck.reset(new BoardDesignRuleCheck(*this));
 
         // try to open/create the board file
         if (create)
@@ -318,7 +324,6 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 
         rebuildAllPlanes();
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
@@ -355,6 +360,7 @@ Board::~Board() noexcept
     Q_ASSERT(!mIsAddedToProject);
 
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
+    mDesignRuleCheck.reset();
 
     // delete all items
     qDeleteAll(mAirWires);          mAirWires.clear();
@@ -408,7 +414,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
     // footprints & pads
     foreach (BI_Device* device, mDeviceInstances) {
         BI_Footprint& footprint = device->getFootprint();
-        if (footprint.isSelectable() && footprint.getGrabAreaScenePx().contains(scenePosPx)) {
+        if (footprint.isSelectable() && footprint.isGrabAreaAtScenePosPx(scenePosPx)) {
             if (footprint.getIsMirrored()) {
                 list.append(&footprint);
             } else {
@@ -416,7 +422,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
             }
         }
         foreach (BI_FootprintPad* pad, footprint.getPads()) {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(scenePosPx)) {
+            if (pad->isSelectable() && pad->isGrabAreaAtScenePosPx(scenePosPx)) {
                 if (pad->getIsMirrored()) {
                     list.append(pad);
                 } else {
@@ -425,7 +431,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
             }
         }
         foreach (BI_StrokeText* text, device->getFootprint().getStrokeTexts()) {
-            if (text->isSelectable() && text->getGrabAreaScenePx().contains(scenePosPx)) {
+            if (text->isSelectable() && text->isGrabAreaAtScenePosPx(scenePosPx)) {
                 if (GraphicsLayer::isTopLayer(text->getText().getLayerName())) {
                     list.prepend(text);
                 } else {
@@ -436,25 +442,25 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
     }
     // planes
     foreach (BI_Plane* planes, mPlanes) {
-        if (planes->isSelectable() && planes->getGrabAreaScenePx().contains(scenePosPx)) {
+        if (planes->isSelectable() && planes->isGrabAreaAtScenePosPx(scenePosPx)) {
             list.append(planes);
         }
     }
     // polygons
     foreach (BI_Polygon* polygon, mPolygons) {
-        if (polygon->isSelectable() && polygon->getGrabAreaScenePx().contains(scenePosPx)) {
+        if (polygon->isSelectable() && polygon->isGrabAreaAtScenePosPx(scenePosPx)) {
             list.append(polygon);
         }
     }
     // texts
     foreach (BI_StrokeText* text, mStrokeTexts) {
-        if (text->isSelectable() && text->getGrabAreaScenePx().contains(scenePosPx)) {
+        if (text->isSelectable() && text->isGrabAreaAtScenePosPx(scenePosPx)) {
             list.append(text);
         }
     }
     // holes
     foreach (BI_Hole* hole, mHoles) {
-        if (hole->isSelectable() && hole->getGrabAreaScenePx().contains(scenePosPx)) {
+        if (hole->isSelectable() && hole->isGrabAreaAtScenePosPx(scenePosPx)) {
             list.append(hole);
         }
     }
@@ -504,7 +510,7 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const Graphic
     {
         foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
         {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
+            if (pad->isSelectable() && pad->isGrabAreaAtScenePosPx(pos.toPxQPointF())
                 && ((!layer) || (pad->isOnLayer(layer->getName())))
                 && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
             {
@@ -812,6 +818,7 @@ void Board::removeFromProject()
     }
     mIsAddedToProject = false;
     updateErcMessages();
+    mDesignRuleCheck->clearMessages();
     sgl.dismiss();
 }
 
@@ -848,9 +855,38 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
 
 void Board::showInView(GraphicsView& view) noexcept
 {
+    createGraphicsItems();
     view.setScene(mGraphicsScene.data());
 }
 
+void Board::createGraphicsItems() noexcept
+{
+    if (mHasGraphicsItems) return;
+    mHasGraphicsItems = true; // new items will create their graphics items from now on
+    foreach (BI_Device* device, mDeviceInstances) {
+        device->createGraphicsItems();
+    }
+    foreach (BI_NetSegment* netsegment, mNetSegments) {
+        netsegment->createGraphicsItems();
+    }
+    foreach (BI_Plane* plane, mPlanes) {
+        plane->createGraphicsItems();
+    }
+    foreach (BI_Polygon* polygon, mPolygons) {
+        polygon->createGraphicsItems();
+    }
+    foreach (BI_StrokeText* text, mStrokeTexts) {
+        text->createGraphicsItems();
+    }
+    foreach (BI_Hole* hole, mHoles) {
+        hole->createGraphicsItems();
+    }
+    foreach (BI_AirWire* airwire, mAirWires) {
+        airwire->createGraphicsItems();
+    }
+    updateIcon();
+}
+
 void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
 {
     mGraphicsScene->setSelectionRect(p1, p2);
@@ -858,14 +894,14 @@ void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems)
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
         foreach (BI_Device* component, mDeviceInstances) {
             BI_Footprint& footprint = component->getFootprint();
-            bool selectFootprint = footprint.isSelectable() && footprint.getGrabAreaScenePx().intersects(rectPx);
+            bool selectFootprint = footprint.isSelectable() && footprint.isGrabAreaIntersectingScenePx(rectPx);
             footprint.setSelected(selectFootprint);
             foreach (BI_FootprintPad* pad, footprint.getPads()) {
-                bool selectPad = pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
+                bool selectPad = pad->isSelectable() && pad->isGrabAreaIntersectingScenePx(rectPx);
                 pad->setSelected(selectFootprint || selectPad);
             }
             foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
-                bool selectText = text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
+                bool selectText = text->isSelectable() && text->isGrabAreaIntersectingScenePx(rectPx);
                 text->setSelected(selectFootprint || selectText);
             }
         }
@@ -873,19 +909,19 @@ void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems)
             segment->setSelectionRect(rectPx);
         }
         foreach (BI_Plane* plane, mPlanes) {
-            bool select = plane->isSelectable() && plane->getGrabAreaScenePx().intersects(rectPx);
+            bool select = plane->isSelectable() && plane->isGrabAreaIntersectingScenePx(rectPx);
             plane->setSelected(select);
         }
         foreach (BI_Polygon* polygon, mPolygons) {
-            bool select = polygon->isSelectable() && polygon->getGrabAreaScenePx().intersects(rectPx);
+            bool select = polygon->isSelectable() && polygon->isGrabAreaIntersectingScenePx(rectPx);
             polygon->setSelected(select);
         }
         foreach (BI_StrokeText* text, mStrokeTexts) {
-            bool select = text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
+            bool select = text->isSelectable() && text->isGrabAreaIntersectingScenePx(rectPx);
             text->setSelected(select);
         }
         foreach (BI_Hole* hole, mHoles) {
-            bool select = hole->isSelectable() && hole->getGrabAreaScenePx().intersects(rectPx);
+            bool select = hole->isSelectable() && hole->isGrabAreaIntersectingScenePx(rectPx);
             hole->setSelected(select);
         }
     }
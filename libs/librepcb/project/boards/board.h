@@ -65,6 +65,8 @@ class BI_AirWire;
 class BoardLayerStack;
 class BoardFabricationOutputSettings;
 class BoardUserSettings;
+class BoardGeometryCache;
+class BoardDesignRuleCheck;
 class BoardSelectionQuery;
 
 /*****************************************************************************************
@@ -128,6 +130,9 @@ class Board final : public QObject, public AttributeProvider,
         BoardFabricationOutputSettings& getFabricationOutputSettings() noexcept {return *mFabricationOutputSettings;}
         const BoardFabricationOutputSettings& getFabricationOutputSettings() const noexcept {return *mFabricationOutputSettings;}
         bool isEmpty() const noexcept;
+        bool hasGraphicsItems() const noexcept {return mHasGraphicsItems;}
+        BoardGeometryCache& getGeometryCache() const noexcept {return *mGeometryCache;}
+        BoardDesignRuleCheck& getDesignRuleCheck() const noexcept {return *mDesignRuleCheck;}
         QList<BI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
         QList<BI_Via*> getViasAtScenePos(const Point& pos, const NetSignal* netsignal) const noexcept;
         QList<BI_NetPoint*> getNetPointsAtScenePos(const Point& pos, const GraphicsLayer* layer,
@@ -190,6 +195,16 @@ class Board final : public QObject, public AttributeProvider,
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
+
+        /**
+         * @brief Create the graphics items of all board items (if not done yet)
+         *
+         * The graphics items are not created when loading the board, but only when the
+         * board gets shown in a view (see #showInView()). So headless workloads like
+         * exports do not need to allocate any QGraphicsItem. Once this method was
+         * called, all newly created board items create their graphics item immediately.
+         */
+        void createGraphicsItems() noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
@@ -238,6 +253,7 @@ class Board final : public QObject, public AttributeProvider,
         FilePath mFilePath; ///< the filepath of the board.lp file (from the ctor)
         QScopedPointer<SmartSExprFile> mFile;
         bool mIsAddedToProject;
+        bool mHasGraphicsItems; ///< see #createGraphicsItems()
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
         QScopedPointer<BoardLayerStack> mLayerStack;
@@ -245,6 +261,8 @@ class Board final : public QObject, public AttributeProvider,
         QScopedPointer<BoardDesignRules> mDesignRules;
         QScopedPointer<BoardFabricationOutputSettings> mFabricationOutputSettings;
         QScopedPointer<BoardUserSettings> mUserSettings;
+        QScopedPointer<BoardGeometryCache> mGeometryCache;
+        QScopedPointer<BoardDesignRuleCheck> mDesignRuleCheck;
         QRectF mViewRect;
         QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
 
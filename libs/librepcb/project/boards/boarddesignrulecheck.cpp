@@ -0,0 +1,507 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "boarddesignrulecheck.h"
+#include "board.h"
+#include "boardgeometrycache.h"
+#include "boardlayerstack.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/geometry/hole.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/scopeguard.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include <librepcb/library/pkg/packagepad.h>
+#include "../erc/ercmsg.h"
+#include "../circuit/componentinstance.h"
+#include "../circuit/netsignal.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_netline.h"
+#include "items/bi_via.h"
+#include "items/bi_plane.h"
+#include "items/bi_polygon.h"
+#include "items/bi_hole.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardDesignRuleCheck::BoardDesignRuleCheck(Board& board) noexcept :
+    mBoard(board)
+{
+}
+
+BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept
+{
+    clearMessages();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList BoardDesignRuleCheck::getViolationMessages() const noexcept
+{
+    QStringList messages;
+    foreach (const ErcMsg* msg, mMessages) {
+        messages.append(msg->getMsg());
+    }
+    messages.sort();
+    return messages;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int BoardDesignRuleCheck::execute()
+{
+    // the collected geometry is only needed while executing
+    auto sg = scopeGuard([this](){mItems.clear(); mBoardArea.clear();});
+
+    // collect geometry and perform all non-geometric checks (single-threaded, since
+    // the board items must not be accessed from other threads)
+    QVector<Violation> violations;
+    collectItems(violations); // can throw
+    collectBoardArea(); // can throw
+    prepareItems(); // can throw
+
+    // check all tiles in parallel
+    QList<QFuture<TileResult>> futures;
+    foreach (const Tile& tile, createTiles()) {
+        futures.append(QtConcurrent::run([this, tile](){return checkTile(tile);}));
+    }
+    QString error;
+    for (QFuture<TileResult>& future : futures) {
+        TileResult result = future.result(); // waits for the tile to be finished
+        violations += result.violations;
+        if (error.isEmpty()) error = result.error;
+    }
+    if (!error.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Failed to perform the design rule check: %1")).arg(error));
+    }
+
+    updateMessages(violations);
+    return mMessages.count();
+}
+
+void BoardDesignRuleCheck::clearMessages() noexcept
+{
+    qDeleteAll(mMessages);
+    mMessages.clear();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BoardDesignRuleCheck::collectItems(QVector<Violation>& violations)
+{
+    mItems.clear();
+    BoardGeometryCache& cache = mBoard.getGeometryCache();
+
+    // determine copper layers
+    QStringList copperLayers;
+    foreach (const GraphicsLayer* layer, mBoard.getLayerStack().getAllLayers()) {
+        if (layer->isCopperLayer() && layer->isEnabled()) {
+            copperLayers.append(layer->getName());
+        }
+    }
+
+    // pads and holes of devices
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        const QString deviceKey = device->getComponentInstanceUuid().toStr();
+        const QString deviceName = device->getComponentInstance().getName();
+        for (const Hole& hole : device->getFootprint().getLibFootprint().getHoles()) {
+            checkDrill(deviceKey % "/" % hole.getUuid().toStr(),
+                       QString(tr("Hole of %1")).arg(deviceName),
+                       hole.getDiameter(), violations);
+        }
+        foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+            const library::FootprintPad& libPad = pad->getLibPad();
+            QString key = deviceKey % "/" % pad->getLibPadUuid().toStr();
+            QString description = QString(tr("Pad %1:%2"))
+                .arg(deviceName, pad->getLibPackagePad().getName());
+            if (libPad.getBoardSide() == library::FootprintPad::BoardSide::THT) {
+                checkDrill(key, description, libPad.getDrillDiameter(), violations);
+                checkAnnularRing(key, description, qMin(libPad.getWidth(), libPad.getHeight()),
+                                 libPad.getDrillDiameter(), violations);
+            }
+            const void* net = pad->getCompSigInstNetSignal();
+            if (!net) net = pad; // unconnected pads must have clearance to everything
+            ClipperLib::Path outline = cache.getPadSceneOutline(*pad, Length(0),
+                                                                maxArcTolerance());
+            if (outline.empty()) continue;
+            foreach (const QString& layer, copperLayers) {
+                if (pad->isOnLayer(layer)) {
+                    mItems.append(Item{layer, net, key, description, {outline}, {}, {}});
+                }
+            }
+        }
+    }
+
+    // vias and traces
+    foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+        const void* net = &netsegment->getNetSignal();
+        const QString netName = netsegment->getNetSignal().getName();
+        foreach (const BI_Via* via, netsegment->getVias()) {
+            QString key = via->getUuid().toStr();
+            QString description = QString(tr("Via of %1")).arg(netName);
+            checkDrill(key, description, via->getDrillDiameter(), violations);
+            checkAnnularRing(key, description, via->getSize(), via->getDrillDiameter(),
+                             violations);
+            ClipperLib::Path outline = ClipperHelpers::convert(via->getSceneOutline(),
+                                                               maxArcTolerance());
+            if (outline.empty()) continue;
+            foreach (const QString& layer, copperLayers) {
+                mItems.append(Item{layer, net, key, description, {outline}, {}, {}});
+            }
+        }
+        foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+            QString key = netline->getUuid().toStr();
+            QString description = QString(tr("Trace of %1")).arg(netName);
+            if (netline->getWidth() < mSettings.minCopperWidth) {
+                violations.append(Violation{"MinWidth/" % key,
+                    QString(tr("%1 is too thin: %2 mm < %3 mm")).arg(description,
+                    netline->getWidth().toMmString(), mSettings.minCopperWidth.toMmString())});
+            }
+            ClipperLib::Path outline = ClipperHelpers::convert(netline->getSceneOutline(),
+                                                               maxArcTolerance());
+            mItems.append(Item{netline->getLayer().getName(), net, key, description,
+                               {outline}, {}, {}});
+        }
+    }
+
+    // planes
+    foreach (const BI_Plane* plane, mBoard.getPlanes()) {
+        QString key = plane->getUuid().toStr();
+        QString description = QString(tr("Plane of %1")).arg(plane->getNetSignal().getName());
+        if (plane->getMinWidth() < mSettings.minCopperWidth) {
+            violations.append(Violation{"MinWidth/" % key,
+                QString(tr("%1 allows too thin areas: %2 mm < %3 mm")).arg(description,
+                plane->getMinWidth().toMmString(), mSettings.minCopperWidth.toMmString())});
+        }
+        ClipperLib::Paths area = ClipperHelpers::convert(plane->getFragments(),
+                                                         maxArcTolerance());
+        if (area.empty()) continue;
+        mItems.append(Item{plane->getLayerName(), &plane->getNetSignal(), key, description,
+                           area, {}, {}});
+    }
+
+    // holes of the board
+    foreach (const BI_Hole* hole, mBoard.getHoles()) {
+        checkDrill(hole->getUuid().toStr(), tr("Hole"), hole->getHole().getDiameter(),
+                   violations);
+    }
+}
+
+void BoardDesignRuleCheck::collectBoardArea()
+{
+    mBoardArea.clear();
+    ClipperLib::Clipper c;
+    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+        if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+            c.AddPath(ClipperHelpers::convert(polygon->getPolygon().getPath(),
+                                              maxArcTolerance()),
+                      ClipperLib::ptSubject, true);
+        }
+    }
+    c.Execute(ClipperLib::ctXor, mBoardArea, ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+}
+
+void BoardDesignRuleCheck::prepareItems()
+{
+    // the halo is half the clearance (minus the arc tolerance), so two objects violate
+    // the clearance rule exactly if their halos are overlapping
+    const Length halo = (mSettings.minCopperClearance - maxArcTolerance()) / 2;
+    Item* items = mItems.data();
+    const int count = mItems.count();
+    const int chunkSize = qMax(64, count / qMax(1, QThread::idealThreadCount() * 4));
+    QList<QFuture<QString>> futures;
+    for (int start = 0; start < count; start += chunkSize) {
+        const int end = qMin(start + chunkSize, count);
+        futures.append(QtConcurrent::run([items, start, end, halo](){
+            try {
+                ClipperLib::ClipperOffset o;
+                for (int i = start; i < end; ++i) {
+                    items[i].halo = items[i].area;
+                    if (halo > 0) {
+                        ClipperHelpers::offset(o, items[i].halo, halo,
+                                               maxArcTolerance()); // can throw
+                    }
+                    items[i].bounds = getBounds(items[i].halo);
+                }
+                return QString();
+            } catch (const Exception& e) {
+                return e.getMsg();
+            }
+        }));
+    }
+    for (QFuture<QString>& future : futures) {
+        QString error = future.result(); // waits for the chunk to be finished
+        if (!error.isEmpty()) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Failed to perform the design rule check: %1")).arg(error));
+        }
+    }
+}
+
+QVector<BoardDesignRuleCheck::Tile> BoardDesignRuleCheck::createTiles() const noexcept
+{
+    QVector<Tile> tiles;
+    if (mItems.isEmpty()) return tiles;
+
+    // determine the area to check
+    ClipperLib::IntRect area = mItems.first().bounds;
+    foreach (const Item& item, mItems) {
+        area.left = qMin(area.left, item.bounds.left);
+        area.top = qMin(area.top, item.bounds.top);
+        area.right = qMax(area.right, item.bounds.right);
+        area.bottom = qMax(area.bottom, item.bounds.bottom);
+    }
+    area.right += 1; // make right/bottom exclusive
+    area.bottom += 1;
+
+    // determine tile size, but don't create an excessive amount of tiles
+    ClipperLib::cInt size = qMax(mSettings.tileSize.toNm(), LengthBase_t(1000000));
+    ClipperLib::cInt maxExtent = qMax(area.right - area.left, area.bottom - area.top);
+    size = qMax(size, maxExtent / 64 + 1);
+    int columns = static_cast<int>((area.right - area.left + size - 1) / size);
+    int rows = static_cast<int>((area.bottom - area.top + size - 1) / size);
+
+    // create tiles
+    tiles.reserve(columns * rows);
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            Tile tile;
+            tile.rect.left = area.left + x * size;
+            tile.rect.top = area.top + y * size;
+            tile.rect.right = qMin(tile.rect.left + size, area.right);
+            tile.rect.bottom = qMin(tile.rect.top + size, area.bottom);
+            tiles.append(tile);
+        }
+    }
+
+    // assign items to all tiles they are overlapping
+    for (int i = 0; i < mItems.count(); ++i) {
+        const ClipperLib::IntRect& bounds = mItems.at(i).bounds;
+        int x0 = static_cast<int>((bounds.left - area.left) / size);
+        int x1 = static_cast<int>((bounds.right - area.left) / size);
+        int y0 = static_cast<int>((bounds.top - area.top) / size);
+        int y1 = static_cast<int>((bounds.bottom - area.top) / size);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                tiles[y * columns + x].items.append(i);
+            }
+        }
+    }
+
+    // tiles without any items don't need to be checked
+    tiles.erase(std::remove_if(tiles.begin(), tiles.end(),
+                               [](const Tile& t){return t.items.isEmpty();}),
+                tiles.end());
+    return tiles;
+}
+
+BoardDesignRuleCheck::TileResult BoardDesignRuleCheck::checkTile(const Tile& tile) const noexcept
+{
+    TileResult result;
+    try {
+        for (int i = 0; i < tile.items.count(); ++i) {
+            const Item& a = mItems.at(tile.items.at(i));
+            // check the board outline clearance only in the tile containing the top left
+            // corner of the item, to not check (and report) it multiple times
+            if ((a.bounds.left >= tile.rect.left) && (a.bounds.left < tile.rect.right) &&
+                (a.bounds.top >= tile.rect.top) && (a.bounds.top < tile.rect.bottom)) {
+                checkOutlineClearance(a, result); // can throw
+            }
+            for (int k = i + 1; k < tile.items.count(); ++k) {
+                checkClearance(a, mItems.at(tile.items.at(k)), tile, result); // can throw
+            }
+        }
+    } catch (const Exception& e) {
+        result.error = e.getMsg();
+    } catch (const std::exception& e) {
+        result.error = e.what(); // e.g. from ClipperLib
+    }
+    return result;
+}
+
+void BoardDesignRuleCheck::checkClearance(const Item& a, const Item& b, const Tile& tile,
+                                          TileResult& result) const
+{
+    if ((a.net == b.net) || (a.layer != b.layer) || (!intersects(a.bounds, b.bounds))) {
+        return;
+    }
+
+    // the overlapping area of both bounding rects may span several tiles, so only check
+    // the pair in the tile which contains the top left corner of the overlapping area
+    ClipperLib::cInt x = qMax(a.bounds.left, b.bounds.left);
+    ClipperLib::cInt y = qMax(a.bounds.top, b.bounds.top);
+    if ((x < tile.rect.left) || (x >= tile.rect.right) ||
+        (y < tile.rect.top) || (y >= tile.rect.bottom)) {
+        return;
+    }
+
+    ClipperLib::Paths intersections;
+    ClipperLib::Clipper c;
+    c.AddPaths(a.halo, ClipperLib::ptSubject, true);
+    c.AddPaths(b.halo, ClipperLib::ptClip, true);
+    c.Execute(ClipperLib::ctIntersection, intersections, ClipperLib::pftNonZero,
+              ClipperLib::pftNonZero);
+    if (!intersections.empty()) {
+        const Item& first = (a.key < b.key) ? a : b;
+        const Item& second = (a.key < b.key) ? b : a;
+        result.violations.append(Violation{
+            "CopperClearance/" % first.key % "/" % second.key % "/" % a.layer,
+            QString(tr("Clearance violation between %1 and %2 on layer %3"))
+                .arg(first.description, second.description, a.layer)});
+    }
+}
+
+void BoardDesignRuleCheck::checkOutlineClearance(const Item& item, TileResult& result) const
+{
+    if (mBoardArea.empty()) return; // no board outline, nothing to check
+
+    ClipperLib::Paths area = item.area;
+    Length clearance = mSettings.minOutlineClearance - maxArcTolerance();
+    if (clearance > 0) {
+        ClipperHelpers::offset(area, clearance, maxArcTolerance()); // can throw
+    }
+    ClipperLib::Paths outside;
+    ClipperLib::Clipper c;
+    c.AddPaths(area, ClipperLib::ptSubject, true);
+    c.AddPaths(mBoardArea, ClipperLib::ptClip, true);
+    c.Execute(ClipperLib::ctDifference, outside, ClipperLib::pftNonZero,
+              ClipperLib::pftEvenOdd);
+    if (!outside.empty()) {
+        result.violations.append(Violation{"OutlineClearance/" % item.key,
+            QString(tr("%1 is too close to the board outline")).arg(item.description)});
+    }
+}
+
+void BoardDesignRuleCheck::checkDrill(const QString& key, const QString& description,
+                                      const Length& diameter,
+                                      QVector<Violation>& violations) const noexcept
+{
+    if (diameter < mSettings.minDrillDiameter) {
+        violations.append(Violation{"MinDrill/" % key,
+            QString(tr("Drill of %1 is too small: %2 mm < %3 mm")).arg(description,
+            diameter.toMmString(), mSettings.minDrillDiameter.toMmString())});
+    }
+}
+
+void BoardDesignRuleCheck::checkAnnularRing(const QString& key, const QString& description,
+                                            const Length& size, const Length& drill,
+                                            QVector<Violation>& violations) const noexcept
+{
+    Length ring = (size - drill) / 2;
+    if (ring < mSettings.minAnnularRing) {
+        violations.append(Violation{"MinAnnularRing/" % key,
+            QString(tr("Annular ring of %1 is too small: %2 mm < %3 mm")).arg(description,
+            ring.toMmString(), mSettings.minAnnularRing.toMmString())});
+    }
+}
+
+void BoardDesignRuleCheck::updateMessages(const QVector<Violation>& violations) noexcept
+{
+    // objects on several layers may report the same violation multiple times
+    QMap<QString, QString> messages;
+    foreach (const Violation& violation, violations) {
+        if (!messages.contains(violation.key)) {
+            messages.insert(violation.key, violation.msg);
+        }
+    }
+
+    // remove messages of resolved violations
+    foreach (const QString& key, mMessages.keys()) {
+        if (!messages.contains(key)) {
+            delete mMessages.take(key);
+        }
+    }
+
+    // add new messages, or update existing ones (to keep their ignore state)
+    for (auto it = messages.constBegin(); it != messages.constEnd(); ++it) {
+        QString msg = QString(tr("%1 (Board: %2)")).arg(it.value(), mBoard.getName());
+        ErcMsg* ercMsg = mMessages.value(it.key());
+        if (ercMsg) {
+            ercMsg->setMsg(msg);
+        } else {
+            ercMsg = new ErcMsg(mBoard.getProject(), *this, mBoard.getUuid().toStr(),
+                                it.key(), ErcMsg::ErcMsgType_t::BoardError, msg);
+            ercMsg->setVisible(true);
+            mMessages.insert(it.key(), ercMsg);
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+bool BoardDesignRuleCheck::intersects(const ClipperLib::IntRect& a,
+                                      const ClipperLib::IntRect& b) noexcept
+{
+    return (a.left <= b.right) && (b.left <= a.right) &&
+           (a.top <= b.bottom) && (b.top <= a.bottom);
+}
+
+ClipperLib::IntRect BoardDesignRuleCheck::getBounds(const ClipperLib::Paths& paths) noexcept
+{
+    ClipperLib::IntRect rect = {0, 0, 0, 0};
+    bool first = true;
+    for (const ClipperLib::Path& path : paths) {
+        if (path.empty()) continue;
+        ClipperLib::IntRect r = ClipperHelpers::getBounds(path);
+        if (first) {
+            rect = r;
+            first = false;
+        } else {
+            rect.left = qMin(rect.left, r.left);
+            rect.top = qMin(rect.top, r.top);
+            rect.right = qMax(rect.right, r.right);
+            rect.bottom = qMax(rect.bottom, r.bottom);
+        }
+    }
+    return rect;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
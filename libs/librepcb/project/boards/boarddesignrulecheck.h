@@ -0,0 +1,182 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+#define LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <clipper/clipper.hpp>
+#include <librepcb/common/units/all_length_units.h>
+#include "../erc/if_ercmsgprovider.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+
+/*****************************************************************************************
+ *  Class BoardDesignRuleCheck
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardDesignRuleCheck class checks a board against manufacturing rules
+ *
+ * The following checks are performed:
+ *  - Clearance between copper objects (pads, vias, traces, planes) of different nets
+ *  - Minimum width of traces and planes
+ *  - Minimum annular ring of vias and THT pads
+ *  - Minimum drill diameter of vias, THT pads and holes
+ *  - Clearance between copper objects and the board outline
+ *
+ * The copper geometry of the whole board is collected first. Then the board is split into
+ * square tiles which are checked in parallel, each tile only compares the objects which
+ * overlap it. Every found violation is reported as a librepcb::project::ErcMsg, so they
+ * show up in the ERC message list of the project. Messages of violations which do no
+ * longer exist are removed when running the check again.
+ */
+class BoardDesignRuleCheck final : public IF_ErcMsgProvider
+{
+        Q_DECLARE_TR_FUNCTIONS(BoardDesignRuleCheck)
+        DECLARE_ERC_MSG_CLASS_NAME(BoardDesignRuleCheck)
+
+    public:
+
+        /// The limits to check against
+        struct Settings {
+            Length minCopperClearance;
+            Length minCopperWidth;
+            Length minAnnularRing;
+            Length minDrillDiameter;
+            Length minOutlineClearance;
+            Length tileSize; ///< size of the parallel checked tiles (not a rule)
+
+            Settings() noexcept :
+                minCopperClearance(200000), minCopperWidth(200000),
+                minAnnularRing(150000), minDrillDiameter(300000),
+                minOutlineClearance(300000), tileSize(10000000) {}
+        };
+
+        // Constructors / Destructor
+        BoardDesignRuleCheck() = delete;
+        BoardDesignRuleCheck(const BoardDesignRuleCheck& other) = delete;
+        explicit BoardDesignRuleCheck(Board& board) noexcept;
+        ~BoardDesignRuleCheck() noexcept;
+
+        // Getters
+        const Settings& getSettings() const noexcept {return mSettings;}
+        int getViolationCount() const noexcept {return mMessages.count();}
+        QStringList getViolationMessages() const noexcept;
+
+        // Setters
+        void setSettings(const Settings& settings) noexcept {mSettings = settings;}
+
+        // General Methods
+
+        /**
+         * @brief Run the check and update the ERC messages
+         *
+         * @return The number of found violations
+         *
+         * @throw Exception if the check could not be performed
+         */
+        int execute();
+
+        /**
+         * @brief Remove all ERC messages of the last check
+         */
+        void clearMessages() noexcept;
+
+        // Operator Overloadings
+        BoardDesignRuleCheck& operator=(const BoardDesignRuleCheck& rhs) = delete;
+
+
+    private: // Types
+        struct Item {
+            QString layer;                  ///< name of the copper layer
+            const void* net;                ///< the net signal, or a unique dummy if none
+            QString key;                    ///< stable identifier for message keys
+            QString description;            ///< human readable name for messages
+            ClipperLib::Paths area;         ///< the copper area
+            ClipperLib::Paths halo;         ///< area expanded by half the clearance
+            ClipperLib::IntRect bounds;     ///< bounding rect of the halo
+        };
+        struct Violation {
+            QString key;
+            QString msg;
+        };
+        struct Tile {
+            ClipperLib::IntRect rect;       ///< left/top inclusive, right/bottom exclusive
+            QVector<int> items;             ///< indices in #mItems
+        };
+        struct TileResult {
+            QVector<Violation> violations;
+            QString error;
+        };
+
+
+    private: // Methods
+        void collectItems(QVector<Violation>& violations);
+        void collectBoardArea();
+        void prepareItems();
+        QVector<Tile> createTiles() const noexcept;
+        TileResult checkTile(const Tile& tile) const noexcept;
+        void checkClearance(const Item& a, const Item& b, const Tile& tile,
+                            TileResult& result) const;
+        void checkOutlineClearance(const Item& item, TileResult& result) const;
+        void checkDrill(const QString& key, const QString& description,
+                        const Length& diameter, QVector<Violation>& violations) const noexcept;
+        void checkAnnularRing(const QString& key, const QString& description,
+                              const Length& size, const Length& drill,
+                              QVector<Violation>& violations) const noexcept;
+        void updateMessages(const QVector<Violation>& violations) noexcept;
+
+        /**
+         * Returns the tolerance used when flattening arcs. Clearances may be smaller
+         * than the rule by this value without being reported, otherwise the inaccuracy
+         * of flattened arcs (e.g. in planes) would lead to false positives.
+         */
+        static Length maxArcTolerance() noexcept {return Length(5000);}
+        static bool intersects(const ClipperLib::IntRect& a,
+                               const ClipperLib::IntRect& b) noexcept;
+        static ClipperLib::IntRect getBounds(const ClipperLib::Paths& paths) noexcept;
+
+
+    private: // Data
+        Board& mBoard;
+        Settings mSettings;
+        QVector<Item> mItems;               ///< only valid while executing
+        ClipperLib::Paths mBoardArea;       ///< only valid while executing
+        QHash<QString, ErcMsg*> mMessages;  ///< key: message key
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
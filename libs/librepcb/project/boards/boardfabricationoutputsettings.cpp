@@ -52,8 +52,12 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings() noexcept :
     mSilkscreenLayersTop({GraphicsLayer::sTopPlacement, GraphicsLayer::sTopNames}),
     mSilkscreenLayersBot({GraphicsLayer::sBotPlacement, GraphicsLayer::sBotNames}),
     mMergeDrillFiles(false),
+    mOptimizeDrillOrder(false),
     mEnableSolderPasteTop(false),
-    mEnableSolderPasteBot(false)
+    mEnableSolderPasteBot(false),
+    mPanelColumns(1),
+    mPanelRows(1),
+    mPanelPitch(0, 0)
 {
 }
 
@@ -83,6 +87,14 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings(const SExpression
     mMergeDrillFiles       = node.getValueByPath<bool   >("drills/merge"           , false);
     mEnableSolderPasteTop  = node.getValueByPath<bool   >("solderpaste_top/create" , false);
     mEnableSolderPasteBot  = node.getValueByPath<bool   >("solderpaste_bot/create" , false);
+    if (const SExpression* child = node.tryGetChildByPath("drills/optimize")) {
+        mOptimizeDrillOrder = child->getValueOfFirstChild<bool>(false); // optional
+    }
+    if (const SExpression* panel = node.tryGetChildByPath("panel")) { // optional
+        mPanelColumns = panel->getValueByPath<int>("columns", true);
+        mPanelRows    = panel->getValueByPath<int>("rows"   , true);
+        mPanelPitch   = Point(panel->getChildByPath("pitch"));
+    }
 
     mSilkscreenLayersTop.clear();
     foreach (const SExpression& child, node.getChildByPath("silkscreen_top/layers").getChildren()) {
@@ -125,6 +137,7 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const
 
     SExpression& drills = root.appendList("drills", true);
     drills.appendTokenChild("merge", mMergeDrillFiles, false);
+    drills.appendTokenChild("optimize", mOptimizeDrillOrder, false);
     drills.appendStringChild("suffix_pth"   , mSuffixDrillsPth , true);
     drills.appendStringChild("suffix_npth"  , mSuffixDrillsNpth, true);
     drills.appendStringChild("suffix_merged", mSuffixDrills    , true);
@@ -136,6 +149,11 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const
     SExpression& solderPasteBot = root.appendList("solderpaste_bot", true);
     solderPasteBot.appendTokenChild("create", mEnableSolderPasteBot, false);
     solderPasteBot.appendStringChild("suffix", mSuffixSolderPasteBot, false);
+
+    SExpression& panel = root.appendList("panel", true);
+    panel.appendTokenChild("columns", mPanelColumns, false);
+    panel.appendTokenChild("rows", mPanelRows, false);
+    panel.appendChild(mPanelPitch.serializeToDomElement("pitch"), false);
 }
 
 /*****************************************************************************************
@@ -162,8 +180,12 @@ BoardFabricationOutputSettings& BoardFabricationOutputSettings::operator=(
     mSilkscreenLayersTop   = rhs.mSilkscreenLayersTop  ;
     mSilkscreenLayersBot   = rhs.mSilkscreenLayersBot  ;
     mMergeDrillFiles       = rhs.mMergeDrillFiles      ;
+    mOptimizeDrillOrder    = rhs.mOptimizeDrillOrder   ;
     mEnableSolderPasteTop  = rhs.mEnableSolderPasteTop ;
     mEnableSolderPasteBot  = rhs.mEnableSolderPasteBot ;
+    mPanelColumns          = rhs.mPanelColumns         ;
+    mPanelRows             = rhs.mPanelRows            ;
+    mPanelPitch            = rhs.mPanelPitch           ;
     return *this;
 }
 
@@ -186,8 +208,12 @@ bool BoardFabricationOutputSettings::operator==(const BoardFabricationOutputSett
     if (mSilkscreenLayersTop   != rhs.mSilkscreenLayersTop  ) return false;
     if (mSilkscreenLayersBot   != rhs.mSilkscreenLayersBot  ) return false;
     if (mMergeDrillFiles       != rhs.mMergeDrillFiles      ) return false;
+    if (mOptimizeDrillOrder    != rhs.mOptimizeDrillOrder   ) return false;
     if (mEnableSolderPasteTop  != rhs.mEnableSolderPasteTop ) return false;
     if (mEnableSolderPasteBot  != rhs.mEnableSolderPasteBot ) return false;
+    if (mPanelColumns          != rhs.mPanelColumns         ) return false;
+    if (mPanelRows             != rhs.mPanelRows            ) return false;
+    if (mPanelPitch            != rhs.mPanelPitch           ) return false;
     return true;
 }
 
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/units/point.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -67,8 +68,12 @@ class BoardFabricationOutputSettings final : public SerializableObject
         const QStringList& getSilkscreenLayersTop() const noexcept {return mSilkscreenLayersTop;}
         const QStringList& getSilkscreenLayersBot() const noexcept {return mSilkscreenLayersBot;}
         bool getMergeDrillFiles()                   const noexcept {return mMergeDrillFiles;}
+        bool getOptimizeDrillOrder()                const noexcept {return mOptimizeDrillOrder;}
         bool getEnableSolderPasteTop()              const noexcept {return mEnableSolderPasteTop;}
         bool getEnableSolderPasteBot()              const noexcept {return mEnableSolderPasteBot;}
+        int getPanelColumns()                       const noexcept {return mPanelColumns;}
+        int getPanelRows()                          const noexcept {return mPanelRows;}
+        const Point& getPanelPitch()                const noexcept {return mPanelPitch;}
 
         // Setters
         void setOutputBasePath(const QString& p)          noexcept {mOutputBasePath = p;}
@@ -88,8 +93,12 @@ class BoardFabricationOutputSettings final : public SerializableObject
         void setSilkscreenLayersTop(const QStringList& l) noexcept {mSilkscreenLayersTop = l;}
         void setSilkscreenLayersBot(const QStringList& l) noexcept {mSilkscreenLayersBot = l;}
         void setMergeDrillFiles(bool m)                   noexcept {mMergeDrillFiles = m;}
+        void setOptimizeDrillOrder(bool o)                noexcept {mOptimizeDrillOrder = o;}
         void setEnableSolderPasteTop(bool e)              noexcept {mEnableSolderPasteTop = e;}
         void setEnableSolderPasteBot(bool e)              noexcept {mEnableSolderPasteBot = e;}
+        void setPanelColumns(int c)                       noexcept {mPanelColumns = c;}
+        void setPanelRows(int r)                          noexcept {mPanelRows = r;}
+        void setPanelPitch(const Point& p)                noexcept {mPanelPitch = p;}
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -118,8 +127,12 @@ class BoardFabricationOutputSettings final : public SerializableObject
         QStringList mSilkscreenLayersTop;
         QStringList mSilkscreenLayersBot;
         bool mMergeDrillFiles;
+        bool mOptimizeDrillOrder; ///< reorder drills to reduce the travel distance
         bool mEnableSolderPasteTop;
         bool mEnableSolderPasteBot;
+        int mPanelColumns; ///< see librepcb::project::BoardGerberExport::setPanelization()
+        int mPanelRows; ///< see librepcb::project::BoardGerberExport::setPanelization()
+        Point mPanelPitch; ///< see librepcb::project::BoardGerberExport::setPanelization()
 };
 
 /*****************************************************************************************
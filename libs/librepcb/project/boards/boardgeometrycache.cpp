@@ -0,0 +1,158 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "boardgeometrycache.h"
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include "items/bi_footprintpad.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardGeometryCache::BoardGeometryCache() noexcept
+{
+}
+
+BoardGeometryCache::~BoardGeometryCache() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+ClipperLib::Path BoardGeometryCache::getPadSceneOutline(const BI_FootprintPad& pad,
+                                                        const Length& expansion,
+                                                        const Length& maxArcTolerance) noexcept
+{
+    const library::FootprintPad& libPad = pad.getLibPad();
+    if (libPad.getShape() == library::FootprintPad::Shape::ROUND) {
+        // arcs must be flattened at their final position, see class documentation
+        return ClipperHelpers::convert(pad.getSceneOutline(expansion), maxArcTolerance);
+    }
+    Length width = libPad.getWidth() + (expansion * 2);
+    Length height = libPad.getHeight() + (expansion * 2);
+    if ((width <= 0) || (height <= 0)) {
+        return ClipperLib::Path();
+    }
+    Key key{static_cast<int>(libPad.getShape()), width.toNm(), height.toNm()};
+    return transform(getCachedPath(key), pad.getRotation(), pad.getPosition());
+}
+
+void BoardGeometryCache::clear() noexcept
+{
+    QMutexLocker locker(&mMutex);
+    mPaths.clear();
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+ClipperLib::Path BoardGeometryCache::transform(const ClipperLib::Path& path,
+                                               const Angle& rotation,
+                                               const Point& position) noexcept
+{
+    // Note: The case distinction and the floating point arithmetic must be exactly the
+    // same as in Point::rotate(), otherwise the result would differ by one nanometer.
+    const ClipperLib::cInt dx = position.getX().toNm();
+    const ClipperLib::cInt dy = position.getY().toNm();
+    const Angle rot = rotation.mappedTo0_360deg();
+    ClipperLib::Path result;
+    result.reserve(path.size());
+    if (rot == Angle::deg90()) {
+        for (const ClipperLib::IntPoint& p : path) {
+            result.push_back(ClipperLib::IntPoint(dx - p.Y, dy + p.X));
+        }
+    } else if (rot == Angle::deg180()) {
+        for (const ClipperLib::IntPoint& p : path) {
+            result.push_back(ClipperLib::IntPoint(dx - p.X, dy - p.Y));
+        }
+    } else if (rot == Angle::deg270()) {
+        for (const ClipperLib::IntPoint& p : path) {
+            result.push_back(ClipperLib::IntPoint(dx + p.Y, dy - p.X));
+        }
+    } else if (rotation != Angle::deg0()) {
+        // not a multiple of 90 degrees --> we must use floating point arithmetic
+        const qreal sin = qSin(rotation.toRad());
+        const qreal cos = qCos(rotation.toRad());
+        for (const ClipperLib::IntPoint& p : path) {
+            result.push_back(ClipperLib::IntPoint(
+                dx + static_cast<LengthBase_t>(cos * p.X - sin * p.Y),
+                dy + static_cast<LengthBase_t>(sin * p.X + cos * p.Y)));
+        }
+    } else {
+        for (const ClipperLib::IntPoint& p : path) {
+            result.push_back(ClipperLib::IntPoint(dx + p.X, dy + p.Y));
+        }
+    }
+    return result;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+ClipperLib::Path BoardGeometryCache::getCachedPath(const Key& key) noexcept
+{
+    {
+        QMutexLocker locker(&mMutex);
+        auto it = mPaths.constFind(key);
+        if (it != mPaths.constEnd()) {
+            return *it;
+        }
+    }
+
+    // create the outline without holding the lock, other threads may continue
+    // (the tolerance doesn't matter since the cached outlines contain no arcs)
+    ClipperLib::Path path = ClipperHelpers::convert(createOutline(key), Length(0));
+    QMutexLocker locker(&mMutex);
+    mPaths.insert(key, path);
+    return path;
+}
+
+Path BoardGeometryCache::createOutline(const Key& key) noexcept
+{
+    Length width(key.width);
+    Length height(key.height);
+    switch (static_cast<library::FootprintPad::Shape>(key.shape)) {
+        case library::FootprintPad::Shape::RECT:    return Path::centeredRect(width, height);
+        case library::FootprintPad::Shape::OCTAGON: return Path::octagon(width, height);
+        default:                                    Q_ASSERT(false); return Path();
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
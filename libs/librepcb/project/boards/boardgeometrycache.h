@@ -0,0 +1,159 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDGEOMETRYCACHE_H
+#define LIBREPCB_PROJECT_BOARDGEOMETRYCACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <clipper/clipper.hpp>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/geometry/path.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class BI_FootprintPad;
+
+/*****************************************************************************************
+ *  Class BoardGeometryCache
+ ****************************************************************************************/
+
+/**
+ * @brief Cache of flattened pad outlines shared by all footprints of a board
+ *
+ * Boards often contain hundreds of identical footprints (e.g. 0402 resistors), so
+ * creating the outline of every pad instance again and again for each expansion
+ * (clearance, stop mask, ...) is a waste of time. This cache stores the outlines of
+ * pads without arcs (centered at the origin and not rotated) keyed by their shape and
+ * expanded size. Only the rotation and translation is applied per instance, with
+ * exactly the same arithmetic as librepcb::Path::rotated() and
+ * librepcb::Path::translated(), so the result is bit-identical to converting the
+ * scene outline.
+ *
+ * Round pads are always flattened at their final position since flattening arcs is
+ * not translation-invariant (the interpolated points are rounded), thus a cached
+ * outline would differ by up to one nanometer. Vias and holes are not handled by this
+ * class at all, use librepcb::ClipperHelpers::convert() and
+ * librepcb::ClipperHelpers::convertCircle() (which caches by position) instead.
+ *
+ * The cache is keyed by the pad geometry instead of the footprint UUID, thus it can
+ * never return outdated outlines if a library element was modified, and identical pads
+ * of different footprints share the same entry.
+ *
+ * @note All methods are thread-safe.
+ */
+class BoardGeometryCache final
+{
+    public:
+
+        // Constructors / Destructor
+        BoardGeometryCache() noexcept;
+        BoardGeometryCache(const BoardGeometryCache& other) = delete;
+        ~BoardGeometryCache() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Get the flattened outline of a pad in scene coordinates
+         *
+         * Returns exactly the same as converting
+         * librepcb::project::BI_FootprintPad::getSceneOutline() with
+         * librepcb::ClipperHelpers::convert(), but faster for pads without arcs.
+         *
+         * @param pad               The pad to get the outline from.
+         * @param expansion         Offset of the outline (e.g. clearance).
+         * @param maxArcTolerance   Maximum tolerance when flattening arcs.
+         *
+         * @return The outline (empty if the expanded pad has no area)
+         */
+        ClipperLib::Path getPadSceneOutline(const BI_FootprintPad& pad,
+                                            const Length& expansion,
+                                            const Length& maxArcTolerance) noexcept;
+
+        /**
+         * @brief Remove all cached outlines
+         */
+        void clear() noexcept;
+
+        // Static Methods
+
+        /**
+         * @brief Rotate and translate a path
+         *
+         * Uses exactly the same arithmetic as librepcb::Point::rotate(), so the result is
+         * identical to converting a librepcb::Path without arcs after calling
+         * librepcb::Path::rotated() and librepcb::Path::translated(). Rotations by
+         * multiples of 90° are done without floating point arithmetic.
+         *
+         * @param path      The path to transform.
+         * @param rotation  Rotation around the origin (applied first).
+         * @param position  Translation (applied after the rotation).
+         *
+         * @return The transformed path
+         */
+        static ClipperLib::Path transform(const ClipperLib::Path& path, const Angle& rotation,
+                                          const Point& position) noexcept;
+
+        // Operator Overloadings
+        BoardGeometryCache& operator=(const BoardGeometryCache& rhs) = delete;
+
+
+    private: // Types
+        struct Key {
+            int shape; ///< library::FootprintPad::Shape (without arcs)
+            LengthBase_t width;
+            LengthBase_t height;
+
+            bool operator==(const Key& rhs) const noexcept {
+                return (shape == rhs.shape) && (width == rhs.width) &&
+                       (height == rhs.height);
+            }
+            friend uint qHash(const Key& key, uint seed = 0) noexcept {
+                seed = ::qHash(key.shape, seed);
+                seed ^= ::qHash(key.width, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                seed ^= ::qHash(key.height, seed) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
+
+    private: // Methods
+        ClipperLib::Path getCachedPath(const Key& key) noexcept;
+        static Path createOutline(const Key& key) noexcept;
+
+
+    private: // Data
+        QMutex mMutex;
+        QHash<Key, ClipperLib::Path> mPaths; ///< outlines centered at the origin
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDGEOMETRYCACHE_H
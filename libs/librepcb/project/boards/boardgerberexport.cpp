@@ -28,6 +28,8 @@
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/geometry/circle.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 #include "../metadata/projectmetadata.h"
@@ -58,7 +60,11 @@ namespace project {
  ****************************************************************************************/
 
 BoardGerberExport::BoardGerberExport(const Board& board) noexcept :
-    mProject(board.getProject()), mBoard(board), mCurrentInnerCopperLayer(0)
+    mProject(board.getProject()), mBoard(board),
+    mPanelColumns(board.getFabricationOutputSettings().getPanelColumns()),
+    mPanelRows(board.getFabricationOutputSettings().getPanelRows()),
+    mPanelPitch(board.getFabricationOutputSettings().getPanelPitch()),
+    mCurrentInnerCopperLayer(0)
 {
 }
 
@@ -75,12 +81,33 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept
     return getOutputFilePath("dummy").getParentDir(); // use dummy suffix
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void BoardGerberExport::setPanelization(int columns, int rows, const Point& pitch)
+{
+    checkPanelization(columns, rows, pitch); // can throw
+    mPanelColumns = columns;
+    mPanelRows = rows;
+    mPanelPitch = pitch;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void BoardGerberExport::exportAllLayers() const
 {
+    checkPanelization(mPanelColumns, mPanelRows, mPanelPitch); // can throw
+    mDrillTravelLengths.clear();
+    prepareLayers(); // can throw
+    auto cleanup = scopeGuard([this](){
+        mLayerIds.clear();
+        mLayerNames.clear();
+        mLayerPrimitives.clear();
+    });
+
     if (mBoard.getFabricationOutputSettings().getMergeDrillFiles()) {
         exportDrills();
     } else {
@@ -129,37 +156,50 @@ QVector<const AttributeProvider*> BoardGerberExport::getAttributeProviderParents
 void BoardGerberExport::exportDrills() const
 {
     ExcellonGenerator gen;
+    applyPanelization(gen);
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     drawPthDrills(gen);
     drawNpthDrills(gen);
     gen.generate();
-    gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrills()));
+    FilePath fp = getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrills());
+    addDrillTravelLength(gen, fp);
+    gen.saveToFile(fp);
 }
 
 void BoardGerberExport::exportDrillsNpth() const
 {
     ExcellonGenerator gen;
+    applyPanelization(gen);
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     int count = drawNpthDrills(gen);
     if (count > 0) {
         // Some PCB manufacturers don't like to have separate drill files for PTH and NPTH.
         // As many boards don't have non-plated holes anyway, we create this file only if
         // it's really needed. Maybe this avoids unnecessary issues with manufacturers...
         gen.generate();
-        gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrillsNpth()));
+        FilePath fp = getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrillsNpth());
+        addDrillTravelLength(gen, fp);
+        gen.saveToFile(fp);
     }
 }
 
 void BoardGerberExport::exportDrillsPth() const
 {
     ExcellonGenerator gen;
+    applyPanelization(gen);
+    gen.setOptimizeDrillOrder(mBoard.getFabricationOutputSettings().getOptimizeDrillOrder());
     drawPthDrills(gen);
     gen.generate();
-    gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrillsPth()));
+    FilePath fp = getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixDrillsPth());
+    addDrillTravelLength(gen, fp);
+    gen.saveToFile(fp);
 }
 
 void BoardGerberExport::exportLayerBoardOutlines() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sBoardOutlines);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixOutlines()));
@@ -169,6 +209,7 @@ void BoardGerberExport::exportLayerTopCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sTopCopper);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperTop()));
@@ -178,6 +219,7 @@ void BoardGerberExport::exportLayerBottomCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sBotCopper);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperBot()));
@@ -189,6 +231,7 @@ void BoardGerberExport::exportLayerInnerCopper() const
         mCurrentInnerCopperLayer = i; // used for attribute provider
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
+        applyPanelization(gen);
         drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
         gen.generate();
         gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixCopperInner()));
@@ -200,6 +243,7 @@ void BoardGerberExport::exportLayerTopSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sTopStopMask);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderMaskTop()));
@@ -209,6 +253,7 @@ void BoardGerberExport::exportLayerBottomSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sBotStopMask);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderMaskBot()));
@@ -220,6 +265,7 @@ void BoardGerberExport::exportLayerTopSilkscreen() const
     if (layers.count() > 0) { // don't create silkscreen file if no layers selected
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
+        applyPanelization(gen);
         foreach (const QString& layer, layers) {
             drawLayer(gen, layer);
         }
@@ -236,6 +282,7 @@ void BoardGerberExport::exportLayerBottomSilkscreen() const
     if (layers.count() > 0) { // don't create silkscreen file if no layers selected
         GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                             mBoard.getUuid(), mProject.getMetadata().getVersion());
+        applyPanelization(gen);
         foreach (const QString& layer, layers) {
             drawLayer(gen, layer);
         }
@@ -250,6 +297,7 @@ void BoardGerberExport::exportLayerTopSolderPaste() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sTopSolderPaste);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderPasteTop()));
@@ -259,6 +307,7 @@ void BoardGerberExport::exportLayerBottomSolderPaste() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
+    applyPanelization(gen);
     drawLayer(gen, GraphicsLayer::sBotSolderPaste);
     gen.generate();
     gen.saveToFile(getOutputFilePath(mBoard.getFabricationOutputSettings().getSuffixSolderPasteBot()));
@@ -315,174 +364,270 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName) const
 {
-    // draw footprints incl. pads
+    int layerId = mLayerIds.value(layerName, -1);
+    if (layerId < 0) {
+        throw LogicError(__FILE__, __LINE__); // layer was not prepared
+    }
+
+    foreach (const Primitive& p, mLayerPrimitives.at(layerId)) {
+        switch (p.type) {
+            case Primitive::Type::Line:
+                gen.drawLine(p.position, p.endPosition, p.lineWidth);
+                break;
+            case Primitive::Type::PathOutline:
+                gen.drawPathOutline(p.path, p.lineWidth);
+                break;
+            case Primitive::Type::PathArea:
+                gen.drawPathArea(p.path);
+                break;
+            case Primitive::Type::CircleOutline:
+                gen.drawCircleOutline(Circle(Uuid(), layerName, p.lineWidth, false, false,
+                                             p.position, p.width));
+                break;
+            case Primitive::Type::CircleArea:
+                gen.drawCircleArea(Circle(Uuid(), layerName, p.lineWidth, true, false,
+                                          p.position, p.width));
+                break;
+            case Primitive::Type::FlashCircle:
+                gen.flashCircle(p.position, p.width, Length(0));
+                break;
+            case Primitive::Type::FlashRect:
+                gen.flashRect(p.position, p.width, p.height, p.rotation, Length(0));
+                break;
+            case Primitive::Type::FlashObround:
+                gen.flashObround(p.position, p.width, p.height, p.rotation, Length(0));
+                break;
+            case Primitive::Type::FlashOctagon:
+                gen.flashRegularPolygon(p.position, p.width, 8, p.rotation, Length(0));
+                break;
+            default:
+                throw LogicError(__FILE__, __LINE__);
+        }
+    }
+}
+
+void BoardGerberExport::prepareLayers() const
+{
+    mLayerIds.clear();
+    mLayerNames.clear();
+    mLayerPrimitives.clear();
+
+    // intern all layers which are exported
+    const BoardFabricationOutputSettings& settings = mBoard.getFabricationOutputSettings();
+    addLayer(GraphicsLayer::sBoardOutlines);
+    addLayer(GraphicsLayer::sTopCopper);
+    for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+        addLayer(GraphicsLayer::getInnerLayerName(i));
+    }
+    addLayer(GraphicsLayer::sBotCopper);
+    addLayer(GraphicsLayer::sTopStopMask);
+    addLayer(GraphicsLayer::sBotStopMask);
+    foreach (const QString& layer, settings.getSilkscreenLayersTop()) {
+        addLayer(layer);
+    }
+    foreach (const QString& layer, settings.getSilkscreenLayersBot()) {
+        addLayer(layer);
+    }
+    addLayer(GraphicsLayer::sTopSolderPaste);
+    addLayer(GraphicsLayer::sBotSolderPaste);
+
+    // collect all primitives in a single pass over the board (the order of the
+    // primitives within a layer is relevant to get reproducible gerber files)
     foreach (const BI_Device* device, mBoard.getDeviceInstances()) { Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerName);
+        collectFootprint(device->getFootprint()); // can throw
     }
 
-    // draw vias
-    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
+    QList<BI_NetSegment*> netsegments = sortedByUuid(mBoard.getNetSegments());
+    foreach (const BI_NetSegment* netsegment, netsegments) { Q_ASSERT(netsegment);
         foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) { Q_ASSERT(via);
-            drawVia(gen, *via, layerName);
+            collectVia(*via); // can throw
         }
     }
 
-    // draw traces
-    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
+    foreach (const BI_NetSegment* netsegment, netsegments) { Q_ASSERT(netsegment);
         foreach (const BI_NetLine* netline, sortedByUuid(netsegment->getNetLines())) { Q_ASSERT(netline);
-            if (netline->getLayer().getName() == layerName) {
-                gen.drawLine(netline->getStartPoint().getPosition(),
-                             netline->getEndPoint().getPosition(),
-                             netline->getWidth());
-            }
+            Primitive p;
+            p.type = Primitive::Type::Line;
+            p.position = netline->getStartPoint().getPosition();
+            p.endPosition = netline->getEndPoint().getPosition();
+            p.lineWidth = netline->getWidth();
+            addPrimitive(mLayerIds.value(netline->getLayer().getName(), -1), p);
         }
     }
 
-    // draw planes
     foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) { Q_ASSERT(plane);
-        if (plane->getLayerName() == layerName) {
-            foreach (const Path& fragment, plane->getFragments()) {
-                gen.drawPathArea(fragment);
-            }
+        int layerId = mLayerIds.value(plane->getLayerName(), -1);
+        if (layerId < 0) continue;
+        foreach (const Path& fragment, plane->getFragments()) {
+            Primitive p;
+            p.type = Primitive::Type::PathArea;
+            p.path = fragment;
+            addPrimitive(layerId, p);
         }
     }
 
-    // draw polygons
-    foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) {
-        Q_ASSERT(polygon);
-        if (layerName == polygon->getPolygon().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
-            gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
-        }
+    foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) { Q_ASSERT(polygon);
+        const QString& layerName = polygon->getPolygon().getLayerName();
+        Primitive p;
+        p.type = Primitive::Type::PathOutline;
+        p.path = polygon->getPolygon().getPath();
+        p.lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
+        addPrimitive(mLayerIds.value(layerName, -1), p);
     }
 
-    // draw stroke texts
     foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) { Q_ASSERT(text);
-        if (layerName == text->getText().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-            foreach (Path path, text->getText().getPaths()) {
-                path.rotate(text->getText().getRotation());
-                if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-                path.translate(text->getText().getPosition());
-                gen.drawPathOutline(path, lineWidth);
-            }
-        }
+        collectStrokeText(*text, text->getText().getPosition());
     }
 }
 
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const
+void BoardGerberExport::addLayer(const QString& layerName) const noexcept
 {
-    bool drawCopper = via.isOnLayer(layerName);
-    bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask || layerName == GraphicsLayer::sBotStopMask)
-                        && mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter());
-    if (drawCopper || drawStopMask) {
-        Length outerDiameter = via.getSize();
-        if (drawStopMask) {
-            outerDiameter += mBoard.getDesignRules().calcStopMaskClearance(via.getSize()) * 2;
-        }
-        switch (via.getShape())
-        {
-            case BI_Via::Shape::Round: {
-                gen.flashCircle(via.getPosition(), outerDiameter, Length(0));
-                break;
-            }
-            case BI_Via::Shape::Square: {
-                gen.flashRect(via.getPosition(), outerDiameter, outerDiameter,
-                              Angle::deg0(), Length(0));
-                break;
-            }
-            case BI_Via::Shape::Octagon: {
-                gen.flashRegularPolygon(via.getPosition(), outerDiameter, 8,
-                                        Angle::deg0(), Length(0));
-                break;
-            }
-            default: {
-                throw LogicError(__FILE__, __LINE__);
-            }
+    if (!mLayerIds.contains(layerName)) {
+        mLayerIds.insert(layerName, mLayerNames.count());
+        mLayerNames.append(layerName);
+        mLayerPrimitives.append(QVector<Primitive>());
+    }
+}
+
+void BoardGerberExport::addPrimitive(int layerId, const Primitive& primitive) const noexcept
+{
+    if (layerId >= 0) { // otherwise the layer is not exported at all
+        mLayerPrimitives[layerId].append(primitive);
+    }
+}
+
+void BoardGerberExport::collectVia(const BI_Via& via) const
+{
+    Primitive p;
+    switch (via.getShape())
+    {
+        case BI_Via::Shape::Round:      p.type = Primitive::Type::FlashCircle; break;
+        case BI_Via::Shape::Square:     p.type = Primitive::Type::FlashRect; break;
+        case BI_Via::Shape::Octagon:    p.type = Primitive::Type::FlashOctagon; break;
+        default:                        throw LogicError(__FILE__, __LINE__);
+    }
+    p.position = via.getPosition();
+    p.rotation = Angle::deg0();
+
+    // copper layers
+    p.width = p.height = via.getSize();
+    for (int i = 0; i < mLayerNames.count(); ++i) {
+        if (via.isOnLayer(mLayerNames.at(i))) {
+            addPrimitive(i, p);
         }
     }
+
+    // stop mask layers
+    if (mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter())) {
+        p.width = p.height = via.getSize() +
+            mBoard.getDesignRules().calcStopMaskClearance(via.getSize()) * 2;
+        addPrimitive(mLayerIds.value(GraphicsLayer::sTopStopMask, -1), p);
+        addPrimitive(mLayerIds.value(GraphicsLayer::sBotStopMask, -1), p);
+    }
 }
 
-void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const
+void BoardGerberExport::collectFootprint(const BI_Footprint& footprint) const
 {
-    // draw pads
+    // pads
     foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerName);
+        collectFootprintPad(*pad); // can throw
     }
 
-    // draw polygons
+    // polygons
     for (const Polygon& polygon : footprint.getLibFootprint().getPolygons().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == polygon.getLayerName()) {
-            Path path = polygon.getPath();
-            path.rotate(footprint.getRotation());
-            if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
-            path.translate(footprint.getPosition());
-            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), layer));
-            if (polygon.isFilled()) {
-                gen.drawPathArea(path);
-            }
+        QString layerName = footprint.getIsMirrored()
+            ? GraphicsLayer::getMirroredLayerName(polygon.getLayerName())
+            : polygon.getLayerName();
+        int layerId = mLayerIds.value(layerName, -1);
+        if (layerId < 0) continue;
+        Primitive p;
+        p.type = Primitive::Type::PathOutline;
+        p.path = polygon.getPath();
+        p.path.rotate(footprint.getRotation());
+        if (footprint.getIsMirrored()) p.path.mirror(Qt::Horizontal);
+        p.path.translate(footprint.getPosition());
+        p.lineWidth = calcWidthOfLayer(polygon.getLineWidth(), polygon.getLayerName());
+        addPrimitive(layerId, p);
+        if (polygon.isFilled()) {
+            p.type = Primitive::Type::PathArea;
+            addPrimitive(layerId, p);
         }
     }
 
-    // draw circles
+    // circles
     for (const Circle& circle : footprint.getLibFootprint().getCircles().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == circle.getLayerName()) {
-            Circle e = circle;
-            if (footprint.getIsMirrored()) e.setCenter(e.getCenter().mirrored(Qt::Horizontal));
-            e.translate(footprint.getPosition());
-            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
-            gen.drawCircleOutline(e);
-            if (e.isFilled()) {
-                gen.drawCircleArea(e);
-            }
+        QString layerName = footprint.getIsMirrored()
+            ? GraphicsLayer::getMirroredLayerName(circle.getLayerName())
+            : circle.getLayerName();
+        int layerId = mLayerIds.value(layerName, -1);
+        if (layerId < 0) continue;
+        Primitive p;
+        p.type = Primitive::Type::CircleOutline;
+        p.position = circle.getCenter();
+        if (footprint.getIsMirrored()) p.position = p.position.mirrored(Qt::Horizontal);
+        p.position += footprint.getPosition();
+        p.lineWidth = calcWidthOfLayer(circle.getLineWidth(), circle.getLayerName());
+        p.width = circle.getDiameter();
+        addPrimitive(layerId, p);
+        if (circle.isFilled()) {
+            p.type = Primitive::Type::CircleArea;
+            addPrimitive(layerId, p);
         }
     }
 
-    // draw stroke texts (from footprint instance, *NOT* from library footprint!)
+    // stroke texts (from footprint instance, *NOT* from library footprint!)
     foreach (const BI_StrokeText* text, sortedByUuid(footprint.getStrokeTexts())) {
-        if (layerName == text->getText().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-            foreach (Path path, text->getText().getPaths()) {
-                path.rotate(text->getText().getRotation());
-                if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-                path.translate(text->getPosition());
-                gen.drawPathOutline(path, lineWidth);
-            }
-        }
+        collectStrokeText(*text, text->getPosition());
     }
 }
 
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const
+void BoardGerberExport::collectFootprintPad(const BI_FootprintPad& pad) const
 {
     bool isSmt = pad.getLibPad().getBoardSide() != library::FootprintPad::BoardSide::THT;
-    bool isOnCopperLayer = pad.isOnLayer(layerName);
-    bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopStopMask);
-    bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotStopMask);
-    bool isOnSolderPasteTop = isSmt && pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopSolderPaste);
-    bool isOnSolderPasteBottom = isSmt && pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotSolderPaste);
-    if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom && !isOnSolderPasteTop && !isOnSolderPasteBottom) {
-        return;
+
+    // copper layers
+    for (int i = 0; i < mLayerNames.count(); ++i) {
+        if (pad.isOnLayer(mLayerNames.at(i))) {
+            collectFootprintPadFlash(i, pad, Length(0)); // can throw
+        }
     }
 
-    Angle rot = pad.getIsMirrored() ? -pad.getRotation() : pad.getRotation();
+    // stop mask and solder paste layers
     const library::FootprintPad& libPad = pad.getLibPad();
-    Length width = libPad.getWidth();
-    Length height = libPad.getHeight();
-    if (isOnSolderMaskTop || isOnSolderMaskBottom) {
-        Length size = qMin(width, height);
-        Length clearance = mBoard.getDesignRules().calcStopMaskClearance(size);
-        width += clearance*2;
-        height += clearance*2;
-    } else if (isOnSolderPasteTop || isOnSolderPasteBottom) {
-        Length size = qMin(width, height);
-        Length clearance = -mBoard.getDesignRules().calcCreamMaskClearance(size);
-        width += clearance*2;
-        height += clearance*2;
-    }
-
-    if ((width <= 0) || (height <= 0)) {
+    Length size = qMin(libPad.getWidth(), libPad.getHeight());
+    Length stopMaskClearance = mBoard.getDesignRules().calcStopMaskClearance(size);
+    Length creamMaskClearance = -mBoard.getDesignRules().calcCreamMaskClearance(size);
+    if (pad.isOnLayer(GraphicsLayer::sTopCopper)) {
+        collectFootprintPadFlash(mLayerIds.value(GraphicsLayer::sTopStopMask, -1),
+                                 pad, stopMaskClearance); // can throw
+        if (isSmt) {
+            collectFootprintPadFlash(mLayerIds.value(GraphicsLayer::sTopSolderPaste, -1),
+                                     pad, creamMaskClearance); // can throw
+        }
+    }
+    if (pad.isOnLayer(GraphicsLayer::sBotCopper)) {
+        collectFootprintPadFlash(mLayerIds.value(GraphicsLayer::sBotStopMask, -1),
+                                 pad, stopMaskClearance); // can throw
+        if (isSmt) {
+            collectFootprintPadFlash(mLayerIds.value(GraphicsLayer::sBotSolderPaste, -1),
+                                     pad, creamMaskClearance); // can throw
+        }
+    }
+}
+
+void BoardGerberExport::collectFootprintPadFlash(int layerId, const BI_FootprintPad& pad,
+                                                 const Length& expansion) const
+{
+    if (layerId < 0) return;
+
+    const library::FootprintPad& libPad = pad.getLibPad();
+    Primitive p;
+    p.position = pad.getPosition();
+    p.rotation = pad.getIsMirrored() ? -pad.getRotation() : pad.getRotation();
+    p.width = libPad.getWidth() + expansion * 2;
+    p.height = libPad.getHeight() + expansion * 2;
+
+    if ((p.width <= 0) || (p.height <= 0)) {
         qWarning() << "Pad with zero size ignored in gerber export:" << pad.getLibPadUuid();
         return;
     }
@@ -490,29 +635,87 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_Footprin
     switch (libPad.getShape())
     {
         case library::FootprintPad::Shape::ROUND: {
-            if (width == height) {
-                gen.flashCircle(pad.getPosition(), width, Length(0));
-            } else {
-                gen.flashObround(pad.getPosition(), width, height, rot, Length(0));
-            }
+            p.type = (p.width == p.height) ? Primitive::Type::FlashCircle
+                                           : Primitive::Type::FlashObround;
             break;
         }
         case library::FootprintPad::Shape::RECT: {
-            gen.flashRect(pad.getPosition(), width, height, rot, Length(0));
+            p.type = Primitive::Type::FlashRect;
             break;
         }
         case library::FootprintPad::Shape::OCTAGON: {
-            if (width != height) {
+            if (p.width != p.height) {
                 throw LogicError(__FILE__, __LINE__,
                     tr("Sorry, non-square octagons are not yet supported."));
             }
-            gen.flashRegularPolygon(pad.getPosition(), width, 8, rot, Length(0));
+            p.type = Primitive::Type::FlashOctagon;
             break;
         }
         default: {
             throw LogicError(__FILE__, __LINE__);
         }
     }
+    addPrimitive(layerId, p);
+}
+
+void BoardGerberExport::collectStrokeText(const BI_StrokeText& text, const Point& position) const
+{
+    const QString& layerName = text.getText().getLayerName();
+    int layerId = mLayerIds.value(layerName, -1);
+    if (layerId < 0) return;
+
+    Primitive p;
+    p.type = Primitive::Type::PathOutline;
+    p.lineWidth = calcWidthOfLayer(text.getText().getStrokeWidth(), layerName);
+    foreach (const Path& path, text.getText().getPaths()) {
+        p.path = path;
+        p.path.rotate(text.getText().getRotation());
+        if (text.getText().getMirrored()) p.path.mirror(Qt::Horizontal);
+        p.path.translate(position);
+        addPrimitive(layerId, p);
+    }
+}
+
+void BoardGerberExport::checkPanelization(int columns, int rows, const Point& pitch)
+{
+    if ((columns < 1) || (rows < 1)) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Invalid panel size: %1x%2"))
+            .arg(columns).arg(rows));
+    }
+    // overlapping or mirrored copies would not make sense
+    if ((pitch.getX() < 0) || (pitch.getY() < 0) || ((columns > 1) && (pitch.getX() <= 0))
+        || ((rows > 1) && (pitch.getY() <= 0))) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Invalid panel pitch: %1/%2 mm"))
+            .arg(pitch.getX().toMmString(), pitch.getY().toMmString()));
+    }
+}
+
+void BoardGerberExport::applyPanelization(GerberGenerator& gen) const noexcept
+{
+    gen.setStepAndRepeat(mPanelColumns, mPanelRows, mPanelPitch);
+}
+
+void BoardGerberExport::applyPanelization(ExcellonGenerator& gen) const noexcept
+{
+    gen.setStepAndRepeat(mPanelColumns, mPanelRows, mPanelPitch);
+}
+
+void BoardGerberExport::addDrillTravelLength(const ExcellonGenerator& gen,
+                                             const FilePath& filepath) const noexcept
+{
+    Length original = gen.getTravelLength(false);
+    Length optimized = gen.getTravelLength(true);
+    mDrillTravelLengths.append(DrillTravelLength{filepath, original, optimized});
+    if (mBoard.getFabricationOutputSettings().getOptimizeDrillOrder()) {
+        qInfo().noquote() << QString("Drill travel length of %1: %2 mm (%3 mm before "
+            "optimization, %4% shorter)").arg(filepath.getFilename(),
+            optimized.toMmString(), original.toMmString(),
+            QString::number((original > 0) ? (100.0 * (original - optimized).toNm() /
+                original.toNm()) : 0.0, 'f', 1));
+    } else {
+        qInfo().noquote() << QString("Drill travel length of %1: %2 mm (not optimized)")
+            .arg(filepath.getFilename(), original.toMmString());
+    }
 }
 
 FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const noexcept
@@ -27,6 +27,7 @@
 #include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/geometry/path.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -45,6 +46,7 @@ class Board;
 class BI_Via;
 class BI_Footprint;
 class BI_FootprintPad;
+class BI_StrokeText;
 
 /*****************************************************************************************
  *  Class BoardGerberExport
@@ -62,6 +64,17 @@ class BoardGerberExport final : public QObject, public AttributeProvider
 
     public:
 
+        // Types
+
+        /**
+         * @brief Estimated travel length of the drilling machine for one drill file
+         */
+        struct DrillTravelLength {
+            FilePath filepath;  ///< the generated Excellon file
+            Length original;    ///< travel length with the drills in the original order
+            Length optimized;   ///< travel length of the generated file
+        };
+
         // Constructors / Destructor
         BoardGerberExport() = delete;
         BoardGerberExport(const BoardGerberExport& other) = delete;
@@ -71,6 +84,35 @@ class BoardGerberExport final : public QObject, public AttributeProvider
         // Getters
         FilePath getOutputDirectory() const noexcept;
 
+        /**
+         * @brief Get the drill travel lengths of all drill files of the last export
+         *
+         * Useful to show the effect of the drill order optimization to the user.
+         */
+        const QList<DrillTravelLength>& getDrillTravelLengths() const noexcept {
+            return mDrillTravelLengths;
+        }
+
+        // Setters
+
+        /**
+         * @brief Export a panel with multiple copies of the board instead of one board
+         *
+         * The layers are still generated only once. The copies are created with step
+         * and repeat blocks in the Gerber files and pattern repeats in the Excellon files.
+         * By default, the panelization of the board's fabrication output settings is
+         * used.
+         *
+         * @param columns   Number of copies in X direction (at least 1)
+         * @param rows      Number of copies in Y direction (at least 1)
+         * @param pitch     Distance between the origins of two neighbouring copies,
+         *                  i.e. the board size plus the spacing between the boards
+         *                  (must be positive in each direction with more than one copy)
+         *
+         * @throw Exception if the parameters are invalid
+         */
+        void setPanelization(int columns, int rows, const Point& pitch);
+
         // General Methods
         void exportAllLayers() const;
 
@@ -90,6 +132,27 @@ class BoardGerberExport final : public QObject, public AttributeProvider
 
     private:
 
+        // Types
+
+        /**
+         * @brief A drawable primitive of one output layer
+         *
+         * All primitives of the board are collected once by #prepareLayers(), so the
+         * board doesn't need to be traversed again for every exported file.
+         */
+        struct Primitive {
+            enum class Type {Line, PathOutline, PathArea, CircleOutline, CircleArea,
+                             FlashCircle, FlashRect, FlashObround, FlashOctagon};
+            Type type;
+            Point position;     ///< start point of lines, center of circles and flashes
+            Point endPosition;  ///< end point of lines
+            Length lineWidth;   ///< line width of lines, path outlines and circles
+            Length width;       ///< width of flashes or diameter of circles
+            Length height;      ///< height of flashes
+            Angle rotation;     ///< rotation of flashes
+            Path path;          ///< path of path outlines and areas
+        };
+
         // Private Methods
         void exportDrills() const;
         void exportDrillsNpth() const;
@@ -108,10 +171,21 @@ class BoardGerberExport final : public QObject, public AttributeProvider
         int drawNpthDrills(ExcellonGenerator& gen) const;
         int drawPthDrills(ExcellonGenerator& gen) const;
         void drawLayer(GerberGenerator& gen, const QString& layerName) const;
-        void drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const;
-        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const;
-        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const;
-
+        void prepareLayers() const;
+        void addLayer(const QString& layerName) const noexcept;
+        void addPrimitive(int layerId, const Primitive& primitive) const noexcept;
+        void collectVia(const BI_Via& via) const;
+        void collectFootprint(const BI_Footprint& footprint) const;
+        void collectFootprintPad(const BI_FootprintPad& pad) const;
+        void collectFootprintPadFlash(int layerId, const BI_FootprintPad& pad,
+                                      const Length& expansion) const;
+        void collectStrokeText(const BI_StrokeText& text, const Point& position) const;
+
+        static void checkPanelization(int columns, int rows, const Point& pitch);
+        void applyPanelization(GerberGenerator& gen) const noexcept;
+        void applyPanelization(ExcellonGenerator& gen) const noexcept;
+        void addDrillTravelLength(const ExcellonGenerator& gen,
+                                  const FilePath& filepath) const noexcept;
         FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
         // Static Methods
@@ -129,7 +203,14 @@ class BoardGerberExport final : public QObject, public AttributeProvider
         // Private Member Variables
         const Project& mProject;
         const Board& mBoard;
+        int mPanelColumns;
+        int mPanelRows;
+        Point mPanelPitch;
         mutable int mCurrentInnerCopperLayer;
+        mutable QHash<QString, int> mLayerIds; ///< interned IDs of all exported layers
+        mutable QVector<QString> mLayerNames; ///< index: layer ID
+        mutable QVector<QVector<Primitive>> mLayerPrimitives; ///< index: layer ID
+        mutable QList<DrillTravelLength> mDrillTravelLengths; ///< of the last export
 };
 
 /*****************************************************************************************
@@ -22,6 +22,8 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "boardplanefragmentsbuilder.h"
+#include "board.h"
+#include "boardgeometrycache.h"
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/utils/clipperhelpers.h>
 #include <librepcb/library/pkg/footprint.h>
@@ -64,6 +66,7 @@ QVector<Path> BoardPlaneFragmentsBuilder::buildFragments() noexcept
 {
     try {
         mResult.clear();
+        mConnectedNetSignalAreas.clear();
         addPlaneOutline();
         clipToBoardOutline();
         subtractOtherObjects();
@@ -93,34 +96,36 @@ void BoardPlaneFragmentsBuilder::clipToBoardOutline()
 {
     // determine board area
     ClipperLib::Paths boardArea;
-    ClipperLib::Clipper boardAreaClipper;
+    mClipper.Clear();
     foreach (const BI_Polygon* polygon, mPlane.getBoard().getPolygons()) {
         if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
             ClipperLib::Path path = ClipperHelpers::convert(polygon->getPolygon().getPath(),
                                                             maxArcTolerance());
-            boardAreaClipper.AddPath(path, ClipperLib::ptSubject, true);
+            mClipper.AddPath(path, ClipperLib::ptSubject, true);
         }
     }
-    boardAreaClipper.Execute(ClipperLib::ctXor, boardArea, ClipperLib::pftEvenOdd,
-                             ClipperLib::pftEvenOdd);
+    mClipper.Execute(ClipperLib::ctXor, boardArea, ClipperLib::pftEvenOdd,
+                     ClipperLib::pftEvenOdd);
 
     // perform clearance offset
-    ClipperHelpers::offset(boardArea, -mPlane.getMinClearance(), maxArcTolerance()); // can throw
+    ClipperHelpers::offset(mOffset, boardArea, -mPlane.getMinClearance(),
+                           maxArcTolerance()); // can throw
 
     // if we have no board area, abort here
     if (boardArea.empty()) return;
 
     // clip result to board area
-    ClipperLib::Clipper clip;
-    clip.AddPaths(mResult, ClipperLib::ptSubject, true);
-    clip.AddPaths(boardArea, ClipperLib::ptClip, true);
-    clip.Execute(ClipperLib::ctIntersection, mResult, ClipperLib::pftNonZero,
-                 ClipperLib::pftNonZero);
+    mClipper.Clear();
+    mClipper.AddPaths(mResult, ClipperLib::ptSubject, true);
+    mClipper.AddPaths(boardArea, ClipperLib::ptClip, true);
+    mClipper.Execute(ClipperLib::ctIntersection, mResult, ClipperLib::pftNonZero,
+                     ClipperLib::pftNonZero);
 }
 
 void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 {
-    ClipperLib::Clipper c;
+    ClipperLib::Clipper& c = mClipper;
+    c.Clear();
     c.AddPaths(mResult, ClipperLib::ptSubject, true);
 
     // subtract other planes
@@ -131,25 +136,25 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
         if (&plane->getNetSignal() == &mPlane.getNetSignal()) continue;
         ClipperLib::Paths paths = ClipperHelpers::convert(plane->getFragments(),
                                                           maxArcTolerance());
-        ClipperHelpers::offset(paths, mPlane.getMinClearance(), maxArcTolerance()); // can throw
+        ClipperHelpers::offset(mOffset, paths, mPlane.getMinClearance(),
+                               maxArcTolerance()); // can throw
         c.AddPaths(paths, ClipperLib::ptClip, true);
     }
 
-    // subtract holes and pads from devices
+    // subtract holes and pads from devices (pad outlines are shared by the cache)
+    BoardGeometryCache& cache = mPlane.getBoard().getGeometryCache();
     foreach (const BI_Device* device, mPlane.getBoard().getDeviceInstances()) {
         for (const Hole& hole : device->getFootprint().getLibFootprint().getHoles()) {
             Point pos = device->getFootprint().mapToScene(hole.getPosition());
             Length dia = hole.getDiameter() + mPlane.getMinClearance() * 2;
-            Path path = Path::circle(dia).translated(pos);
-            c.AddPath(ClipperHelpers::convert(path, maxArcTolerance()),
+            c.AddPath(ClipperHelpers::convertCircle(pos, dia, maxArcTolerance()),
                       ClipperLib::ptClip, true);
         }
         foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
             if (!pad->isOnLayer(mPlane.getLayerName())) continue;
             if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
-                ClipperLib::Path path = ClipperHelpers::convert(pad->getSceneOutline(),
-                                                                maxArcTolerance());
-                mConnectedNetSignalAreas.push_back(path);
+                mConnectedNetSignalAreas.push_back(
+                    cache.getPadSceneOutline(*pad, Length(0), maxArcTolerance()));
             }
             c.AddPath(createPadCutOut(*pad), ClipperLib::ptClip, true);
         }
@@ -158,8 +163,8 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
     // subtract board holes
     for (const BI_Hole* hole : mPlane.getBoard().getHoles()) {
         Length dia = hole->getHole().getDiameter() + mPlane.getMinClearance() * 2;
-        Path path = Path::circle(dia).translated(hole->getHole().getPosition());
-        c.AddPath(ClipperHelpers::convert(path, maxArcTolerance()),
+        c.AddPath(ClipperHelpers::convertCircle(hole->getHole().getPosition(), dia,
+                                                maxArcTolerance()),
                   ClipperLib::ptClip, true);
     }
 
@@ -169,9 +174,8 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
         // subtract vias
         foreach (const BI_Via* via, netsegment->getVias()) {
             if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
-                ClipperLib::Path path = ClipperHelpers::convert(via->getSceneOutline(),
-                                                                maxArcTolerance());
-                mConnectedNetSignalAreas.push_back(path);
+                mConnectedNetSignalAreas.push_back(
+                    ClipperHelpers::convert(via->getSceneOutline(), maxArcTolerance()));
             }
             c.AddPath(createViaCutOut(*via), ClipperLib::ptClip, true);
         }
@@ -198,17 +202,18 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 void BoardPlaneFragmentsBuilder::ensureMinimumWidth()
 {
     Length delta = mPlane.getMinWidth() / 2;
-    ClipperHelpers::offset(mResult, -delta, maxArcTolerance()); // can throw
-    ClipperHelpers::offset(mResult, delta, maxArcTolerance()); // can throw
+    ClipperHelpers::offset(mOffset, mResult, -delta, maxArcTolerance()); // can throw
+    ClipperHelpers::offset(mOffset, mResult, delta, maxArcTolerance()); // can throw
 }
 
 void BoardPlaneFragmentsBuilder::flattenResult()
 {
     // convert paths to tree
     ClipperLib::PolyTree tree;
-    ClipperLib::Clipper c;
-    c.AddPaths(mResult, ClipperLib::ptSubject, true);
-    c.Execute(ClipperLib::ctXor, tree, ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+    mClipper.Clear();
+    mClipper.AddPaths(mResult, ClipperLib::ptSubject, true);
+    mClipper.Execute(ClipperLib::ctXor, tree, ClipperLib::pftEvenOdd,
+                     ClipperLib::pftEvenOdd);
 
     // convert tree to simple paths with cut-ins
     mResult = ClipperHelpers::flattenTree(tree); // can throw
@@ -216,17 +221,8 @@ void BoardPlaneFragmentsBuilder::flattenResult()
 
 void BoardPlaneFragmentsBuilder::removeOrphans()
 {
-    mResult.erase(std::remove_if(mResult.begin(), mResult.end(),
-        [this](const ClipperLib::Path& p){
-            ClipperLib::Paths intersections;
-            ClipperLib::Clipper c;
-            c.AddPaths(mConnectedNetSignalAreas, ClipperLib::ptSubject, true);
-            c.AddPath(p, ClipperLib::ptClip, true);
-            c.Execute(ClipperLib::ctIntersection, intersections, ClipperLib::pftNonZero,
-                      ClipperLib::pftNonZero);
-            return intersections.empty();
-        }),
-        mResult.end());
+    ClipperHelpers::removeNonIntersecting(mClipper, mResult,
+                                          mConnectedNetSignalAreas); // can throw
 }
 
 /*****************************************************************************************
@@ -237,7 +233,8 @@ ClipperLib::Path BoardPlaneFragmentsBuilder::createPadCutOut(const BI_FootprintP
 {
     bool differentNetSignal = (pad.getCompSigInstNetSignal() != &mPlane.getNetSignal());
     if ((mPlane.getConnectStyle() == BI_Plane::ConnectStyle::None) || differentNetSignal) {
-        return ClipperHelpers::convert(pad.getSceneOutline(mPlane.getMinClearance()), maxArcTolerance());
+        return mPlane.getBoard().getGeometryCache().getPadSceneOutline(
+            pad, mPlane.getMinClearance(), maxArcTolerance());
     } else {
         return ClipperLib::Path();
     }
@@ -247,7 +244,8 @@ ClipperLib::Path BoardPlaneFragmentsBuilder::createViaCutOut(const BI_Via& via)
 {
     bool differentNetSignal = (&via.getNetSignalOfNetSegment() != &mPlane.getNetSignal());
     if ((mPlane.getConnectStyle() == BI_Plane::ConnectStyle::None) || differentNetSignal) {
-        return ClipperHelpers::convert(via.getSceneOutline(mPlane.getMinClearance()), maxArcTolerance());
+        return ClipperHelpers::convert(via.getSceneOutline(mPlane.getMinClearance()),
+                                       maxArcTolerance());
     } else {
         return ClipperLib::Path();
     }
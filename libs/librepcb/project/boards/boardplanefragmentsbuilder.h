@@ -85,6 +85,10 @@ class BoardPlaneFragmentsBuilder final
         BI_Plane& mPlane;
         ClipperLib::Paths mConnectedNetSignalAreas;
         ClipperLib::Paths mResult;
+
+        // Workspace, reused by all steps to avoid repeated allocations
+        ClipperLib::Clipper mClipper;
+        ClipperLib::ClipperOffset mOffset;
 };
 
 /*****************************************************************************************
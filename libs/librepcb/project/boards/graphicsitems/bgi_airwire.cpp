@@ -67,6 +67,7 @@ bool BGI_AirWire::isSelectable() const noexcept
 void BGI_AirWire::updateCacheAndRepaint() noexcept
 {
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     mLines.clear();
     if (mAirWire.isVertical()) {
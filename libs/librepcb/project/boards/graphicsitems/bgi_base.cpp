@@ -35,9 +35,11 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-BGI_Base::BGI_Base() noexcept
+BGI_Base::BGI_Base() noexcept :
+    QGraphicsItem(), mSceneShapeValid(false)
 {
-
+    // required to get notified about position and transformation changes
+    setFlag(QGraphicsItem::ItemSendsGeometryChanges, true);
 }
 
 BGI_Base::~BGI_Base() noexcept
@@ -45,6 +47,22 @@ BGI_Base::~BGI_Base() noexcept
 
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+const QPainterPath& BGI_Base::getSceneShape() const noexcept
+{
+    if (!mSceneShapeValid) updateSceneShapeCache();
+    return mSceneShape;
+}
+
+const QRectF& BGI_Base::getSceneShapeBoundingRect() const noexcept
+{
+    if (!mSceneShapeValid) updateSceneShapeCache();
+    return mSceneShapeBoundingRect;
+}
+
 /*****************************************************************************************
  *  Protected Methods
  ****************************************************************************************/
@@ -65,6 +83,38 @@ qreal BGI_Base::getZValueOfCopperLayer(const QString& name) noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+QVariant BGI_Base::itemChange(GraphicsItemChange change, const QVariant& value) noexcept
+{
+    switch (change) {
+        case ItemPositionHasChanged:
+        case ItemTransformHasChanged:
+        case ItemRotationHasChanged:
+        case ItemScaleHasChanged:
+        case ItemTransformOriginPointHasChanged:
+        case ItemParentHasChanged:
+            invalidateSceneShapeCache();
+            break;
+        default:
+            break;
+    }
+    return QGraphicsItem::itemChange(change, value);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BGI_Base::updateSceneShapeCache() const noexcept
+{
+    mSceneShape = sceneTransform().map(shape());
+    mSceneShapeBoundingRect = mSceneShape.controlPointRect();
+    mSceneShapeValid = true;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
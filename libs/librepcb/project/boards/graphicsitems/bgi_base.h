@@ -39,6 +39,11 @@ namespace project {
 
 /**
  * @brief The Board Graphics Item Base (BGI_Base) class
+ *
+ * The shape of the item mapped to scene coordinates (and its bounding rect) is cached
+ * since it is needed very often for hit tests (e.g. on every mouse move). The cache is
+ * invalidated automatically when the position or transformation of the item changes.
+ * Subclasses must call #invalidateSceneShapeCache() whenever their shape changes.
  */
 class BGI_Base : public QGraphicsItem
 {
@@ -48,11 +53,19 @@ class BGI_Base : public QGraphicsItem
         explicit BGI_Base() noexcept;
         virtual ~BGI_Base() noexcept;
 
+        // Getters
+        const QPainterPath& getSceneShape() const noexcept;
+        const QRectF& getSceneShapeBoundingRect() const noexcept;
+
 
     protected:
 
+        void invalidateSceneShapeCache() noexcept {mSceneShapeValid = false;}
         static qreal getZValueOfCopperLayer(const QString& name) noexcept;
 
+        // Inherited from QGraphicsItem
+        QVariant itemChange(GraphicsItemChange change, const QVariant& value) noexcept override;
+
 
     private:
 
@@ -60,6 +73,14 @@ class BGI_Base : public QGraphicsItem
         //BGI_Base() = delete;
         BGI_Base(const BGI_Base& other) = delete;
         BGI_Base& operator=(const BGI_Base& rhs) = delete;
+
+        // Private Methods
+        void updateSceneShapeCache() const noexcept;
+
+        // Cached Attributes
+        mutable bool mSceneShapeValid;
+        mutable QPainterPath mSceneShape;
+        mutable QRectF mSceneShapeBoundingRect;
 };
 
 /*****************************************************************************************
@@ -70,9 +70,12 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 {
     GraphicsLayer* layer = nullptr;
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     mBoundingRect = QRectF();
     mShape = QPainterPath();
+    mPolygonPaths.clear();
+    mPolygonBoundingRects.clear();
 
     // set Z value
     if (mFootprint.getIsMirrored())
@@ -93,13 +96,17 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
     // polygons
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
+        QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+        qreal w = polygon.getLineWidth().toPx() / 2;
+        QRectF polygonRect = polygonPath.boundingRect().adjusted(-w, -w, w, w);
+        mPolygonPaths.append(polygonPath);
+        mPolygonBoundingRects.append(polygonRect);
+
         layer = getLayer(polygon.getLayerName());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
-        QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
-        qreal w = polygon.getLineWidth().toPx() / 2;
-        mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
+        mBoundingRect = mBoundingRect.united(polygonRect);
         if (!polygon.isGrabArea()) continue;
         layer = getLayer(GraphicsLayer::sTopGrabAreas);
         if (!layer) continue;
@@ -121,15 +128,38 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
 void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
     const GraphicsLayer* layer = 0;
     const bool selected = mFootprint.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = deviceIsPrinter ? qInf() :
+                      option->levelOfDetailFromTransform(painter->worldTransform());
+
+    // if the whole footprint is only a few pixels large, just draw its bounding rect
+    if (qMax(mBoundingRect.width(), mBoundingRect.height()) * lod < sMinVisibleSizePx) {
+        // use the placement layer of the board side the footprint is placed on
+        QString placementLayerName = GraphicsLayer::sTopPlacement;
+        if (mFootprint.getIsMirrored()) {
+            placementLayerName = GraphicsLayer::getMirroredLayerName(placementLayerName);
+        }
+        layer = mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(placementLayerName);
+        if (layer && layer->isVisible()) {
+            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawRect(mBoundingRect);
+        }
+        return;
+    }
 
     // draw all polygons
-    for (const Polygon& polygon : mLibFootprint.getPolygons()) {
+    for (int i = 0; i < mPolygonPaths.count(); ++i) {
+        const Polygon& polygon = *mLibFootprint.getPolygons().at(i);
+
+        // skip sub-pixel polygons
+        const QRectF& rect = mPolygonBoundingRects.at(i);
+        if (qMax(rect.width(), rect.height()) * lod < sMinFeatureSizePx) continue;
+
         // get layer
         layer = getLayer(polygon.getLayerName());
         if (!layer) continue;
@@ -158,11 +188,14 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         }
 
         // draw polygon
-        painter->drawPath(polygon.getPath().toQPainterPathPx());
+        painter->drawPath(mPolygonPaths.at(i));
     }
 
     // draw all circles
     for (const Circle& circle : mLibFootprint.getCircles()) {
+        // skip sub-pixel circles
+        if ((circle.getDiameter() + circle.getLineWidth()).toPx() * lod < sMinFeatureSizePx) continue;
+
         // get layer
         layer = getLayer(circle.getLayerName());
         if (!layer) continue;
@@ -199,6 +232,9 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 
     // draw all holes
     for (const Hole& hole : mLibFootprint.getHoles()) {
+        // skip sub-pixel holes
+        if (hole.getDiameter().toPx() * lod < sMinFeatureSizePx) continue;
+
         // get layer
         layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
         if (!layer) continue;
@@ -216,8 +252,8 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     // draw origin cross
     layer = getLayer(GraphicsLayer::sTopReferences);
     if (layer) {
-        if ((!deviceIsPrinter) && layer->isVisible()) {
-            qreal width = Length(700000).toPx();
+        qreal width = Length(700000).toPx();
+        if ((!deviceIsPrinter) && layer->isVisible() && (2 * width * lod >= sMinOriginCrossSizePx)) {
             painter->setPen(QPen(layer->getColor(selected), 0));
             painter->drawLine(-width, 0, width, 0);
             painter->drawLine(0, -width, 0, width);
@@ -91,6 +91,13 @@ class BGI_Footprint final : public BGI_Base
         // Cached Attributes
         QRectF mBoundingRect;
         QPainterPath mShape;
+        QVector<QPainterPath> mPolygonPaths;    ///< same order as the library polygons
+        QVector<QRectF> mPolygonBoundingRects;  ///< including the line width
+
+        // Static Variables
+        static constexpr qreal sMinVisibleSizePx = 3;       ///< below: draw bounding rect
+        static constexpr qreal sMinFeatureSizePx = 0.5;     ///< below: skip primitive
+        static constexpr qreal sMinOriginCrossSizePx = 4;   ///< below: skip origin cross
 };
 
 /*****************************************************************************************
@@ -80,6 +80,7 @@ bool BGI_FootprintPad::isSelectable() const noexcept
 void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 {
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     // set Z value
     if ((mLibPad.getBoardSide() == library::FootprintPad::BoardSide::BOTTOM) != mPad.getIsMirrored()) {
@@ -115,6 +116,7 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
     // set shapes and bounding rect
     mShape = mLibPad.getOutline().toQPainterPathPx();
     mCopper = mLibPad.toQPainterPathPx();
+    mCopperBoundingRect = mCopper.boundingRect();
     mStopMask = mLibPad.getOutline(stopMaskClearance).toQPainterPathPx();
     mCreamMask = mLibPad.getOutline(creamMaskClearance).toQPainterPathPx();
     mBoundingRect = mStopMask.boundingRect();
@@ -128,14 +130,22 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 
 void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
-    //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
-    //const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = deviceIsPrinter ? qInf() :
+                      option->levelOfDetailFromTransform(painter->worldTransform());
 
     const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
     bool highlight = mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    if (qMax(mBoundingRect.width(), mBoundingRect.height()) * lod < sMinVisibleSizePx) {
+        // the pad is only a few pixels large, draw just the copper bounding rect
+        if (mPadLayer && mPadLayer->isVisible()) {
+            painter->fillRect(mCopperBoundingRect, mPadLayer->getColor(highlight));
+        }
+        return;
+    }
+
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
@@ -155,10 +165,12 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
         painter->setPen(Qt::NoPen);
         painter->setBrush(mPadLayer->getColor(highlight));
         painter->drawPath(mCopper);
-        // draw pad text
-        painter->setFont(mFont);
-        painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-        painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        // draw pad text (only if it is large enough to be readable)
+        if (mFont.pixelSize() * lod >= sMinTextSizePx) {
+            painter->setFont(mFont);
+            painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+            painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        }
     }
 
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
@@ -99,7 +99,12 @@ class BGI_FootprintPad final : public BGI_Base
         QPainterPath mStopMask;
         QPainterPath mCreamMask;
         QRectF mBoundingRect;
+        QRectF mCopperBoundingRect;
         QFont mFont;
+
+        // Static Variables
+        static constexpr qreal sMinVisibleSizePx = 2;   ///< below: draw bounding rect only
+        static constexpr qreal sMinTextSizePx = 4;      ///< below: skip pad text
 };
 
 /*****************************************************************************************
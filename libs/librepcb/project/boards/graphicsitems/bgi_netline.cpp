@@ -69,6 +69,7 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
     setToolTip(mNetLine.getNetSignalOfNetSegment().getName());
 
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     // set Z value
     setZValue(getZValueOfCopperLayer(mNetLine.getLayer().getName()));
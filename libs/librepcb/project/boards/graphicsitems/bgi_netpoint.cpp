@@ -68,6 +68,7 @@ void BGI_NetPoint::updateCacheAndRepaint() noexcept
     setToolTip(mNetPoint.getNetSignalOfNetSegment().getName());
 
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     // set Z value
     setZValue(getZValueOfCopperLayer(mNetPoint.getLayer().getName()));
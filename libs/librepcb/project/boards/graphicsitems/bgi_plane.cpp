@@ -67,6 +67,7 @@ bool BGI_Plane::isSelectable() const noexcept
 void BGI_Plane::updateCacheAndRepaint() noexcept
 {
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     setZValue(getZValueOfCopperLayer(mPlane.getLayerName()));
 
@@ -79,6 +80,7 @@ void BGI_Plane::updateCacheAndRepaint() noexcept
 
     // get areas
     mAreas.clear();
+    mSimplifiedAreas.clear();
     for (const Path& r : mPlane.getFragments()) {
         mAreas.append(r.toQPainterPathPx());
         mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
@@ -98,19 +100,24 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     const bool selected = mPlane.isSelected();
     //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
-    Q_UNUSED(option);
+    const QRectF deviceRect = QRectF(QPointF(0, 0), mBoundingRect.size() * lod);
 
     if (mLayer && mLayer->isVisible()) {
-        // draw outline
-        painter->setPen(QPen(mLayer->getColor(selected), 3 / lod, Qt::DashLine, Qt::RoundCap));
-        painter->setBrush(Qt::NoBrush);
-        painter->drawPath(mOutline);
-
-        // draw plane
-        painter->setPen(Qt::NoPen);
-        painter->setBrush(mLayer->getColor(selected));
-        foreach (const QPainterPath& area, mAreas) {
-            painter->drawPath(area);
+        if ((deviceRect.width() < sMinVisibleSizePx) && (deviceRect.height() < sMinVisibleSizePx)) {
+            // the whole plane is smaller than a few pixels, just draw its bounding rect
+            painter->fillRect(mBoundingRect, mLayer->getColor(selected));
+        } else {
+            // draw outline
+            painter->setPen(QPen(mLayer->getColor(selected), 3 / lod, Qt::DashLine, Qt::RoundCap));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawPath(mOutline);
+
+            // draw plane (with simplified fragments when zoomed out)
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(mLayer->getColor(selected));
+            foreach (const QPainterPath& area, getAreasForLod(lod)) {
+                painter->drawPath(area);
+            }
         }
     }
 
@@ -138,6 +145,30 @@ GraphicsLayer* BGI_Plane::getLayer(QString name) const noexcept
     return mPlane.getBoard().getLayerStack().getLayer(name);
 }
 
+const QVector<QPainterPath>& BGI_Plane::getAreasForLod(qreal lod) noexcept
+{
+    if (lod >= sMaxSimplifyLod) {
+        return mAreas;
+    }
+
+    // quantize the LOD to powers of two to get a small number of cached variants
+    int key = qFloor(std::log2(qMax(lod, qreal(1e-6))));
+    auto it = mSimplifiedAreas.find(key);
+    if (it == mSimplifiedAreas.end()) {
+        qreal tolerance = sSimplifyTolerancePx / qPow(2, key + 1); // device px -> scene px
+        QVector<QPainterPath> areas;
+        areas.reserve(mAreas.count());
+        foreach (const QPainterPath& area, mAreas) {
+            QPainterPath simplified = Toolbox::simplifiedPath(area, tolerance);
+            if (!simplified.isEmpty()) {
+                areas.append(simplified);
+            }
+        }
+        it = mSimplifiedAreas.insert(key, areas);
+    }
+    return *it;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
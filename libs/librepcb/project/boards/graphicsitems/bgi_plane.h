@@ -79,6 +79,7 @@ class BGI_Plane final : public BGI_Base
 
         // Private Methods
         GraphicsLayer* getLayer(QString name) const noexcept;
+        const QVector<QPainterPath>& getAreasForLod(qreal lod) noexcept;
 
         // General Attributes
         BI_Plane& mPlane;
@@ -89,6 +90,12 @@ class BGI_Plane final : public BGI_Base
         QPainterPath mShape;
         QPainterPath mOutline;
         QVector<QPainterPath> mAreas;
+        QHash<int, QVector<QPainterPath>> mSimplifiedAreas; ///< key: log2 of the LOD
+
+        // Static Variables
+        static constexpr qreal sMinVisibleSizePx = 2;   ///< smaller: only bounding rect filled
+        static constexpr qreal sMaxSimplifyLod = 4;     ///< no simplification above
+        static constexpr qreal sSimplifyTolerancePx = 0.5;
 };
 
 /*****************************************************************************************
@@ -74,6 +74,7 @@ bool BGI_Via::isSelectable() const noexcept
 void BGI_Via::updateCacheAndRepaint() noexcept
 {
     prepareGeometryChange();
+    invalidateSceneShapeCache();
 
     setToolTip(mVia.getNetSignalOfNetSegment().getName());
 
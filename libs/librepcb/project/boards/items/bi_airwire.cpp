@@ -22,6 +22,8 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "bi_airwire.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
 #include "../../circuit/netsignal.h"
 
 /*****************************************************************************************
@@ -37,7 +39,9 @@ namespace project {
 BI_AirWire::BI_AirWire(Board& board, const NetSignal& netsignal, const Point& p1, const Point& p2) :
     BI_Base(board), mNetSignal(netsignal), mP1(p1), mP2(p2)
 {
-    mGraphicsItem.reset(new BGI_AirWire(*this));
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 }
 
 BI_AirWire::~BI_AirWire() noexcept
@@ -54,7 +58,7 @@ void BI_AirWire::addToBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     mHighlightChangedConnection = connect(&mNetSignal, &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
 }
 
@@ -67,24 +71,55 @@ void BI_AirWire::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_AirWire::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_AirWire(*this));
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 /*****************************************************************************************
  *  Inherited from BI_Base
  ****************************************************************************************/
 
 QPainterPath BI_AirWire::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape();
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        QPainterPath path;
+        path.addRect(getGrabAreaBoundingRectScenePx());
+        return path;
+    }
+}
+
+QRectF BI_AirWire::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        // same as the bounding rect of librepcb::project::BGI_AirWire
+        if (isVertical()) {
+            Length size(200000);
+            Point p1 = mP1 + Point(size, size);
+            Point p2 = mP1 - Point(size, size);
+            return QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+        } else {
+            return QRectF(mP1.toPxQPointF(), mP2.toPxQPointF()).normalized();
+        }
+    }
 }
 
 void BI_AirWire::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 bool BI_AirWire::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    const GraphicsLayer* layer = mBoard.getLayerStack().getLayer(GraphicsLayer::sBoardAirWires);
+    return layer && layer->isVisible();
 }
 
 /*****************************************************************************************
@@ -61,6 +61,24 @@ Circuit& BI_Base::getCircuit() const noexcept
     return mBoard.getProject().getCircuit();
 }
 
+QRectF BI_Base::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    return getGrabAreaScenePx().controlPointRect();
+}
+
+bool BI_Base::isGrabAreaAtScenePosPx(const QPointF& pos) const noexcept
+{
+    // the bounding rect check is very cheap compared to QPainterPath::contains()
+    return getGrabAreaBoundingRectScenePx().contains(pos)
+        && getGrabAreaScenePx().contains(pos);
+}
+
+bool BI_Base::isGrabAreaIntersectingScenePx(const QRectF& rect) const noexcept
+{
+    return getGrabAreaBoundingRectScenePx().intersects(rect)
+        && getGrabAreaScenePx().intersects(rect);
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -92,6 +110,15 @@ void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept
     mIsAddedToBoard = false;
 }
 
+void BI_Base::addCreatedGraphicsItem(QGraphicsItem& item) noexcept
+{
+    // if the item is already added to the board, the new graphics item is missing
+    // in the scene, otherwise it will be added by addToBoard() later
+    if (mIsAddedToBoard) {
+        mBoard.getGraphicsScene().addItem(item);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
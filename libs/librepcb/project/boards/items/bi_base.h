@@ -84,6 +84,9 @@ class BI_Base : public QObject
         virtual const Point& getPosition() const noexcept = 0;
         virtual bool getIsMirrored() const noexcept = 0;
         virtual QPainterPath getGrabAreaScenePx() const noexcept = 0;
+        virtual QRectF getGrabAreaBoundingRectScenePx() const noexcept;
+        bool isGrabAreaAtScenePosPx(const QPointF& pos) const noexcept;
+        bool isGrabAreaIntersectingScenePx(const QRectF& rect) const noexcept;
         virtual bool isAddedToBoard() const noexcept {return mIsAddedToBoard;}
         virtual bool isSelectable() const noexcept = 0;
         virtual bool isSelected() const noexcept {return mIsSelected;}
@@ -95,6 +98,16 @@ class BI_Base : public QObject
         virtual void addToBoard() = 0;
         virtual void removeFromBoard() = 0;
 
+        /**
+         * @brief Create the graphics item(s) of this board item (if not done yet)
+         *
+         * Graphics items are only created on demand when the board gets shown in a
+         * view (see librepcb::project::Board::createGraphicsItems()), so workloads
+         * without any view (e.g. exports) never allocate them. Until then, the grab
+         * area and selectability are derived from the model.
+         */
+        virtual void createGraphicsItems() noexcept = 0;
+
         // Operator Overloadings
         BI_Base& operator=(const BI_Base& rhs) = delete;
 
@@ -104,6 +117,7 @@ class BI_Base : public QObject
         // General Methods
         void addToBoard(QGraphicsItem* item) noexcept;
         void removeFromBoard(QGraphicsItem* item) noexcept;
+        void addCreatedGraphicsItem(QGraphicsItem& item) noexcept;
 
 
     protected:
@@ -226,6 +226,11 @@ void BI_Device::removeFromBoard()
     updateErcMessages();
 }
 
+void BI_Device::createGraphicsItems() noexcept
+{
+    mFootprint->createGraphicsItems();
+}
+
 void BI_Device::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -280,6 +285,11 @@ QPainterPath BI_Device::getGrabAreaScenePx() const noexcept
     return mFootprint->getGrabAreaScenePx();
 }
 
+QRectF BI_Device::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    return mFootprint->getGrabAreaBoundingRectScenePx();
+}
+
 bool BI_Device::isSelectable() const noexcept
 {
     return mFootprint->isSelectable();
@@ -94,6 +94,7 @@ class BI_Device final : public BI_Base, public AttributeProvider,
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -111,6 +112,7 @@ class BI_Device final : public BI_Base, public AttributeProvider,
         const Point& getPosition() const noexcept override {return mPosition;}
         bool getIsMirrored() const noexcept override {return mIsMirrored;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
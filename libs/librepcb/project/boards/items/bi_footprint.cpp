@@ -25,6 +25,7 @@
 #include "bi_footprintpad.h"
 #include "../cmd/cmdfootprintstroketextsreset.h"
 #include "../board.h"
+#include "../boardlayerstack.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../library/projectlibrary.h"
@@ -73,10 +74,10 @@ BI_Footprint::BI_Footprint(BI_Device& device) :
 
 void BI_Footprint::init()
 {
-    // create graphics item
-    mGraphicsItem.reset(new BGI_Footprint(*this));
-    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
-    updateGraphicsItemTransform();
+    // create graphics item (only if the board is already shown in a view)
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // load pads
     const library::Device& libDev = mDevice.getLibDevice();
@@ -219,6 +220,22 @@ void BI_Footprint::removeFromBoard()
     sgl.dismiss();
 }
 
+void BI_Footprint::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_Footprint(*this));
+        mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+        updateGraphicsItemTransform();
+        addCreatedGraphicsItem(*mGraphicsItem);
+    }
+    foreach (BI_FootprintPad* pad, mPads) {
+        pad->createGraphicsItems();
+    }
+    foreach (BI_StrokeText* text, mStrokeTexts) {
+        text->createGraphicsItems();
+    }
+}
+
 void BI_Footprint::serialize(SExpression& root) const
 {
     serializePointerContainerUuidSorted(root, mStrokeTexts, "stroke_text");
@@ -265,18 +282,52 @@ bool BI_Footprint::getIsMirrored() const noexcept
 
 QPainterPath BI_Footprint::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    }
+
+    // same shape as the one of librepcb::project::BGI_Footprint
+    QPainterPath shape;
+    if (isLayerVisible(GraphicsLayer::sTopReferences)) {
+        qreal width = Length(700000).toPx();
+        shape.addRect(QRectF(-width, -width, 2*width, 2*width));
+    }
+    bool grabAreasVisible = isLayerVisible(GraphicsLayer::sTopGrabAreas);
+    for (const Polygon& polygon : getLibFootprint().getPolygons()) {
+        if (grabAreasVisible && polygon.isGrabArea()
+            && isLayerVisible(polygon.getLayerName())) {
+            shape = shape.united(polygon.getPath().toQPainterPathPx());
+        }
+    }
+    if (!shape.isEmpty()) {
+        shape.setFillRule(Qt::WindingFill);
+    }
+    QTransform t;
+    if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
+    t.rotate(-mDevice.getRotation().toDeg());
+    t *= QTransform::fromTranslate(mDevice.getPosition().toPxQPointF().x(),
+                                   mDevice.getPosition().toPxQPointF().y());
+    return t.map(shape);
+}
+
+QRectF BI_Footprint::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_Footprint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return isLayerVisible(GraphicsLayer::sTopReferences);
 }
 
 void BI_Footprint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
     foreach (BI_FootprintPad* pad, mPads)
         pad->setSelected(selected);
     foreach (BI_StrokeText* text, mStrokeTexts)
@@ -289,14 +340,16 @@ void BI_Footprint::setSelected(bool selected) noexcept
 
 void BI_Footprint::deviceInstanceAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
-    mGraphicsItem->setPos(pos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(pos.toPxQPointF());
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
         mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -309,8 +362,10 @@ void BI_Footprint::deviceInstanceMoved(const Point& pos)
 void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 {
     Q_UNUSED(rot);
-    updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        updateGraphicsItemTransform();
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
         mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -320,8 +375,10 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 void BI_Footprint::deviceInstanceMirrored(bool mirrored)
 {
     Q_UNUSED(mirrored);
-    updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        updateGraphicsItemTransform();
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
         mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -332,8 +389,16 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
  *  Private Methods
  ****************************************************************************************/
 
+bool BI_Footprint::isLayerVisible(QString name) const noexcept
+{
+    if (mDevice.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
+    const GraphicsLayer* layer = mBoard.getLayerStack().getLayer(name);
+    return layer && layer->isVisible();
+}
+
 void BI_Footprint::updateGraphicsItemTransform() noexcept
 {
+    Q_ASSERT(mGraphicsItem);
     QTransform t;
     if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mDevice.getRotation().toDeg());
@@ -79,7 +79,8 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         const Angle& getRotation() const noexcept;
         bool isSelectable() const noexcept override;
         bool isUsed() const noexcept;
-        BGI_Footprint& getGraphicsItem() noexcept {return *mGraphicsItem;}
+        /// @return The graphics item, or nullptr if not created yet (see #createGraphicsItems())
+        BGI_Footprint* getGraphicsItem() const noexcept {return mGraphicsItem.data();}
 
         // StrokeText Methods
         const QList<BI_StrokeText*>& getStrokeTexts() const noexcept {return mStrokeTexts;}
@@ -90,6 +91,7 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         void resetStrokeTextsToLibraryFootprint();
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -106,6 +108,7 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         const Point& getPosition() const noexcept override;
         bool getIsMirrored() const noexcept override;
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
@@ -126,6 +129,7 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
 
     private:
         void init();
+        bool isLayerVisible(QString name) const noexcept;
         void updateGraphicsItemTransform() noexcept;
 
         // General
@@ -27,6 +27,7 @@
 #include <librepcb/library/pkg/footprintpad.h>
 #include <librepcb/library/pkg/packagepad.h>
 #include "../board.h"
+#include "../boardlayerstack.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../settings/projectsettings.h"
@@ -64,7 +65,9 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid) :
                 this, &BI_FootprintPad::componentSignalInstanceNetSignalChanged);
     }
 
-    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
     updatePosition();
 
     // connect to the "attributes changed" signal of the footprint
@@ -151,6 +154,15 @@ void BI_FootprintPad::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_FootprintPad::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_FootprintPad::registerNetPoint(BI_NetPoint& netpoint)
 {
     if ((!isAddedToBoard()) || (!mComponentSignalInstance)
@@ -182,9 +194,11 @@ void BI_FootprintPad::updatePosition() noexcept
 {
     mPosition = mFootprint.mapToScene(mFootprintPad->getPosition());
     mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        updateGraphicsItemTransform();
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
@@ -201,18 +215,32 @@ bool BI_FootprintPad::getIsMirrored() const noexcept
 
 QPainterPath BI_FootprintPad::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        return getSceneOutline().toQPainterPathPx();
+    }
+}
+
+QRectF BI_FootprintPad::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_FootprintPad::isSelectable() const noexcept
 {
-    return mFootprint.isSelectable() && mGraphicsItem->isSelectable();
+    const GraphicsLayer* layer = mBoard.getLayerStack().getLayer(getLayerName());
+    return mFootprint.isSelectable() && layer && layer->isVisible();
 }
 
 void BI_FootprintPad::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 Path BI_FootprintPad::getOutline(const Length& expansion) const noexcept
@@ -231,7 +259,7 @@ Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept
 
 void BI_FootprintPad::footprintAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from, NetSignal* to)
@@ -241,7 +269,7 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from, N
     }
     if (to) {
         mHighlightChangedConnection = connect(to, &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
     mBoard.scheduleAirWiresRebuild(from);
     mBoard.scheduleAirWiresRebuild(to);
@@ -35,6 +35,7 @@ namespace librepcb {
 
 namespace library {
 class FootprintPad;
+class PackagePad;
 class ComponentSignal;
 }
 
@@ -74,6 +75,7 @@ class BI_FootprintPad final : public BI_Base
         QString getLayerName() const noexcept;
         bool isOnLayer(const QString& layerName) const noexcept;
         const library::FootprintPad& getLibPad() const noexcept {return *mFootprintPad;}
+        const library::PackagePad& getLibPackagePad() const noexcept {return *mPackagePad;}
         ComponentSignalInstance* getComponentSignalInstance() const noexcept {return mComponentSignalInstance;}
         NetSignal* getCompSigInstNetSignal() const noexcept;
         bool isUsed() const noexcept {return (mRegisteredNetPoints.count() > 0);}
@@ -84,6 +86,7 @@ class BI_FootprintPad final : public BI_Base
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void registerNetPoint(BI_NetPoint& netpoint);
         void unregisterNetPoint(BI_NetPoint& netpoint);
         void updatePosition() noexcept;
@@ -94,6 +97,7 @@ class BI_FootprintPad final : public BI_Base
         const Point& getPosition() const noexcept override {return mPosition;}
         bool getIsMirrored() const noexcept override;
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
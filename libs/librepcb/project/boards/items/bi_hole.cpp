@@ -27,6 +27,7 @@
 #include "../../project.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/holegraphicsitem.h>
+#include <librepcb/common/geometry/path.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -39,14 +40,14 @@ namespace project {
  ****************************************************************************************/
 
 BI_Hole::BI_Hole(Board& board, const BI_Hole& other) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mHole.reset(new Hole(Uuid::createRandom(), *other.mHole));
     init();
 }
 
 BI_Hole::BI_Hole(Board& board, const SExpression& node) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mHole.reset(new Hole(node));
     init();
@@ -54,7 +55,7 @@ BI_Hole::BI_Hole(Board& board, const SExpression& node) :
 }
 
 BI_Hole::BI_Hole(Board& board, const Hole& hole) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mHole.reset(new Hole(hole));
     init();
@@ -62,12 +63,17 @@ BI_Hole::BI_Hole(Board& board, const Hole& hole) :
 
 void BI_Hole::init()
 {
-    mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
+    mHole->registerObserver(*this);
+
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 }
 
 BI_Hole::~BI_Hole() noexcept
 {
     mGraphicsItem.reset();
+    mHole->unregisterObserver(*this);
     mHole.reset();
 }
 
@@ -91,6 +97,15 @@ void BI_Hole::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_Hole::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
+    mGraphicsItem->setSelected(isSelected());
+    addCreatedGraphicsItem(*mGraphicsItem);
+    mGrabAreaValid = false;
+}
+
 void BI_Hole::serialize(SExpression& root) const
 {
     mHole->serialize(root);
@@ -107,7 +122,14 @@ const Point& BI_Hole::getPosition() const noexcept
 
 QPainterPath BI_Hole::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaScenePx;
+}
+
+QRectF BI_Hole::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaBoundingRectScenePx;
 }
 
 const Uuid& BI_Hole::getUuid() const noexcept
@@ -124,7 +146,23 @@ bool BI_Hole::isSelectable() const noexcept
 void BI_Hole::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BI_Hole::updateGrabAreaCache() const noexcept
+{
+    if (mGraphicsItem) {
+        mGrabAreaScenePx = mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    } else {
+        mGrabAreaScenePx = Path::circle(mHole->getDiameter())
+                .translated(mHole->getPosition()).toQPainterPathPx();
+    }
+    mGrabAreaBoundingRectScenePx = mGrabAreaScenePx.controlPointRect();
+    mGrabAreaValid = true;
 }
 
 /*****************************************************************************************
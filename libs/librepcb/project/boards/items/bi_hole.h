@@ -46,8 +46,11 @@ class Board;
 
 /**
  * @brief The BI_Hole class
+ *
+ * The grab area in scene coordinates is cached and invalidated whenever the hole
+ * (position or diameter) changes.
  */
-class BI_Hole final : public BI_Base, public SerializableObject
+class BI_Hole final : public BI_Base, public SerializableObject, public IF_HoleObserver
 {
         Q_OBJECT
 
@@ -70,6 +73,7 @@ class BI_Hole final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -79,6 +83,7 @@ class BI_Hole final : public BI_Base, public SerializableObject
         const Point& getPosition() const noexcept override;
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
@@ -87,11 +92,19 @@ class BI_Hole final : public BI_Base, public SerializableObject
 
     private: // Methods
         void init();
+        void updateGrabAreaCache() const noexcept;
+        void holePositionChanged(const Point& newPos) noexcept override {Q_UNUSED(newPos); mGrabAreaValid = false;}
+        void holeDiameterChanged(const Length& newDiameter) noexcept override {Q_UNUSED(newDiameter); mGrabAreaValid = false;}
 
 
     private: // Data
         QScopedPointer<Hole> mHole;
         QScopedPointer<HoleGraphicsItem> mGraphicsItem;
+
+        // Cached Attributes
+        mutable bool mGrabAreaValid;
+        mutable QPainterPath mGrabAreaScenePx;
+        mutable QRectF mGrabAreaBoundingRectScenePx;
 };
 
 /*****************************************************************************************
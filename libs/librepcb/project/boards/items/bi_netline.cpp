@@ -107,7 +107,9 @@ void BI_NetLine::init()
             tr("BI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new BGI_NetLine(*this));
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -185,7 +187,7 @@ void BI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -208,7 +210,7 @@ void BI_NetLine::addToBoard()
 
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                               &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
     sg.dismiss();
 }
@@ -234,7 +236,14 @@ void BI_NetLine::removeFromBoard()
 void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+}
+
+void BI_NetLine::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_NetLine(*this));
+    addCreatedGraphicsItem(*mGraphicsItem);
 }
 
 void BI_NetLine::serialize(SExpression& root) const
@@ -253,18 +262,31 @@ void BI_NetLine::serialize(SExpression& root) const
 
 QPainterPath BI_NetLine::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape();
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        return getSceneOutline().toQPainterPathPx();
+    }
+}
+
+QRectF BI_NetLine::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_NetLine::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return getLayer().isVisible();
 }
 
 void BI_NetLine::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
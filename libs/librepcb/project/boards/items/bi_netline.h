@@ -85,6 +85,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void updateLine() noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
@@ -96,6 +97,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
         const Point& getPosition() const noexcept override {return mPosition;}
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
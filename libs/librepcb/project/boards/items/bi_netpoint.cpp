@@ -153,9 +153,10 @@ void BI_NetPoint::init()
         }
     }
 
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    // create the graphics item (only if the board is already shown in a view)
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mBoard.getProject(), *this,
@@ -233,7 +234,7 @@ void BI_NetPoint::setPadToAttach(BI_FootprintPad* pad)
         sgl.dismiss();
     }
     mFootprintPad = pad;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setViaToAttach(BI_Via* via)
@@ -264,14 +265,14 @@ void BI_NetPoint::setViaToAttach(BI_Via* via)
         sgl.dismiss();
     }
     mVia = via;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateLines();
         mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     }
@@ -301,7 +302,7 @@ void BI_NetPoint::addToBoard()
     }
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     mErcMsgDeadNetPoint->setVisible(true);
     BI_Base::addToBoard(mGraphicsItem.data());
     mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
@@ -340,7 +341,7 @@ void BI_NetPoint::registerNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
@@ -351,7 +352,7 @@ void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
@@ -362,6 +363,14 @@ void BI_NetPoint::updateLines() const noexcept
     }
 }
 
+void BI_NetPoint::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_NetPoint::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -384,18 +393,36 @@ void BI_NetPoint::serialize(SExpression& root) const
 
 QPainterPath BI_NetPoint::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        // same as the bounding rect of librepcb::project::BGI_NetPoint
+        qreal radius = getMaxLineWidth().toPx() / 2;
+        QPainterPath path;
+        path.addRect(QRectF(-radius, -radius, 2*radius, 2*radius)
+                     .translated(mPosition.toPxQPointF()));
+        return path;
+    }
+}
+
+QRectF BI_NetPoint::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_NetPoint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mLayer->isVisible();
 }
 
 void BI_NetPoint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -99,6 +99,7 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void registerNetLine(BI_NetLine& netline);
         void unregisterNetLine(BI_NetLine& netline);
         void updateLines() const noexcept;
@@ -113,6 +114,7 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
         const Point& getPosition() const noexcept override {return mPosition;}
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
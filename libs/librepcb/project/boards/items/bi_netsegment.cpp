@@ -34,6 +34,7 @@
 #include "../../circuit/netsignal.h"
 #include "../../circuit/componentsignalinstance.h"
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/toolbox.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -55,6 +56,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
         BI_Via* copy = new BI_Via(*this, *via);
         Q_ASSERT(!getViaByUuid(copy->getUuid()));
         mVias.append(copy);
+        mViasByUuid.insert(copy->getUuid(), copy);
         viaMap.insert(via, copy);
     }
     // copy netpoints
@@ -69,6 +71,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
         BI_Via* via = viaMap.value(netpoint->getVia(), nullptr);
         BI_NetPoint* copy = new BI_NetPoint(*this, *netpoint, pad, via);
         mNetPoints.append(copy);
+        mNetPointsByUuid.insert(copy->getUuid(), copy);
         copiedNetPoints.insert(netpoint, copy);
     }
     // copy netlines
@@ -78,6 +81,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
         BI_NetPoint* end = copiedNetPoints.value(&netline->getEndPoint()); Q_ASSERT(end);
         BI_NetLine* copy = new BI_NetLine(*netline, *start, *end);
         mNetLines.append(copy);
+        mNetLinesByUuid.insert(copy->getUuid(), copy);
         copiedNetLines.append(copy);
     }
 }
@@ -105,6 +109,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node) :
                     .arg(via->getUuid().toStr()));
             }
             mVias.append(via);
+            mViasByUuid.insert(via->getUuid(), via);
         }
 
         // Load all netpoints
@@ -116,6 +121,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node) :
                     .arg(netpoint->getUuid().toStr()));
             }
             mNetPoints.append(netpoint);
+            mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
         }
 
         // Load all netlines
@@ -127,6 +133,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node) :
                     .arg(netline->getUuid().toStr()));
             }
             mNetLines.append(netline);
+            mNetLinesByUuid.insert(netline->getUuid(), netline);
         }
 
         if (!areAllNetPointsConnectedTogether()) {
@@ -140,9 +147,9 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node) :
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
-        qDeleteAll(mNetLines);          mNetLines.clear();
-        qDeleteAll(mNetPoints);         mNetPoints.clear();
-        qDeleteAll(mVias);              mVias.clear();
+        qDeleteAll(mNetLines);          mNetLines.clear();      mNetLinesByUuid.clear();
+        qDeleteAll(mNetPoints);         mNetPoints.clear();     mNetPointsByUuid.clear();
+        qDeleteAll(mVias);              mVias.clear();          mViasByUuid.clear();
         throw; // ...and rethrow the exception
     }
 }
@@ -155,9 +162,9 @@ BI_NetSegment::BI_NetSegment(Board& board, NetSignal& signal) :
 BI_NetSegment::~BI_NetSegment() noexcept
 {
     // delete all items
-    qDeleteAll(mNetLines);          mNetLines.clear();
-    qDeleteAll(mNetPoints);         mNetPoints.clear();
-    qDeleteAll(mVias);              mVias.clear();
+    qDeleteAll(mNetLines);          mNetLines.clear();      mNetLinesByUuid.clear();
+    qDeleteAll(mNetPoints);         mNetPoints.clear();     mNetPointsByUuid.clear();
+    qDeleteAll(mVias);              mVias.clear();          mViasByUuid.clear();
 }
 
 /*****************************************************************************************
@@ -173,7 +180,7 @@ int BI_NetSegment::getViasAtScenePos(const Point& pos, QList<BI_Via*>& vias) con
 {
     int count = 0;
     foreach (BI_Via* via, mVias) {
-        if (via->isSelectable() && via->getGrabAreaScenePx().contains(pos.toPxQPointF()))
+        if (via->isSelectable() && via->isGrabAreaAtScenePosPx(pos.toPxQPointF()))
         {
             vias.append(via);
             ++count;
@@ -188,7 +195,7 @@ int BI_NetSegment::getNetPointsAtScenePos(const Point& pos, const GraphicsLayer*
     int count = 0;
     foreach (BI_NetPoint* netpoint, mNetPoints) {
         if (netpoint->isSelectable()
-            && netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF())
+            && netpoint->isGrabAreaAtScenePosPx(pos.toPxQPointF())
             && ((!layer) || (&netpoint->getLayer() == layer)))
         {
             points.append(netpoint);
@@ -204,7 +211,7 @@ int BI_NetSegment::getNetLinesAtScenePos(const Point& pos, const GraphicsLayer*
     int count = 0;
     foreach (BI_NetLine* netline, mNetLines) {
         if (netline->isSelectable()
-            && netline->getGrabAreaScenePx().contains(pos.toPxQPointF())
+            && netline->isGrabAreaAtScenePosPx(pos.toPxQPointF())
             && ((!layer) || (&netline->getLayer() == layer)))
         {
             lines.append(netline);
@@ -240,11 +247,7 @@ void BI_NetSegment::setNetSignal(NetSignal& netsignal)
 
 BI_Via* BI_NetSegment::getViaByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_Via* via, mVias) {
-        if (via->getUuid() == uuid)
-            return via;
-    }
-    return nullptr;
+    return mViasByUuid.value(uuid, nullptr);
 }
 
 /*****************************************************************************************
@@ -253,11 +256,7 @@ BI_Via* BI_NetSegment::getViaByUuid(const Uuid& uuid) const noexcept
 
 BI_NetPoint* BI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_NetPoint* netpoint, mNetPoints) {
-        if (netpoint->getUuid() == uuid)
-            return netpoint;
-    }
-    return nullptr;
+    return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 /*****************************************************************************************
@@ -266,11 +265,7 @@ BI_NetPoint* BI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept
 
 BI_NetLine* BI_NetSegment::getNetLineByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_NetLine* netline, mNetLines) {
-        if (netline->getUuid() == uuid)
-            return netline;
-    }
-    return nullptr;
+    return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 /*****************************************************************************************
@@ -287,7 +282,7 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
 
     ScopeGuardList sgl(netpoints.count() + netlines.count());
     foreach (BI_Via* via, vias) {
-        if ((mVias.contains(via)) || (&via->getNetSegment() != this)) {
+        if ((getViaByUuid(via->getUuid()) == via) || (&via->getNetSegment() != this)) {
             throw LogicError(__FILE__, __LINE__);
         }
         // check if there is no via with the same uuid in the list
@@ -299,10 +294,16 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
         // add to board
         via->addToBoard(); // can throw
         mVias.append(via);
-        sgl.add([this, via](){via->removeFromBoard(); mVias.removeOne(via);});
+        mViasByUuid.insert(via->getUuid(), via);
+        sgl.add([this, via](){
+            via->removeFromBoard();
+            mVias.removeAt(mVias.lastIndexOf(via)); // appended last, so found immediately
+            mViasByUuid.remove(via->getUuid());
+        });
     }
     foreach (BI_NetPoint* netpoint, netpoints) {
-        if ((mNetPoints.contains(netpoint)) || (&netpoint->getNetSegment() != this)) {
+        if ((getNetPointByUuid(netpoint->getUuid()) == netpoint) ||
+            (&netpoint->getNetSegment() != this)) {
             throw LogicError(__FILE__, __LINE__);
         }
         // check if there is no netpoint with the same uuid in the list
@@ -314,10 +315,16 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
         // add to board
         netpoint->addToBoard(); // can throw
         mNetPoints.append(netpoint);
-        sgl.add([this, netpoint](){netpoint->removeFromBoard(); mNetPoints.removeOne(netpoint);});
+        mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+        sgl.add([this, netpoint](){
+            netpoint->removeFromBoard();
+            mNetPoints.removeAt(mNetPoints.lastIndexOf(netpoint)); // appended last, so found immediately
+            mNetPointsByUuid.remove(netpoint->getUuid());
+        });
     }
     foreach (BI_NetLine* netline, netlines) {
-        if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+        if ((getNetLineByUuid(netline->getUuid()) == netline) ||
+            (&netline->getNetSegment() != this)) {
             throw LogicError(__FILE__, __LINE__);
         }
         // check if there is no netline with the same uuid in the list
@@ -329,7 +336,12 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
         // add to board
         netline->addToBoard(); // can throw
         mNetLines.append(netline);
-        sgl.add([this, netline](){netline->removeFromBoard(); mNetLines.removeOne(netline);});
+        mNetLinesByUuid.insert(netline->getUuid(), netline);
+        sgl.add([this, netline](){
+            netline->removeFromBoard();
+            mNetLines.removeAt(mNetLines.lastIndexOf(netline)); // appended last, so found immediately
+            mNetLinesByUuid.remove(netline->getUuid());
+        });
     }
 
     if (!areAllNetPointsConnectedTogether()) {
@@ -349,34 +361,63 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>& vias,
         throw LogicError(__FILE__, __LINE__);
     }
 
-    ScopeGuardList sgl(netpoints.count() + netlines.count());
+    ScopeGuardList sgl(netpoints.count() + netlines.count() + 1);
+    QSet<BI_NetLine*> removedNetLines;
     foreach (BI_NetLine* netline, netlines) {
-        if (!mNetLines.contains(netline)) {
+        if (getNetLineByUuid(netline->getUuid()) != netline) {
             throw LogicError(__FILE__, __LINE__);
         }
         // remove from board
         netline->removeFromBoard(); // can throw
-        mNetLines.removeOne(netline);
-        sgl.add([this, netline](){netline->addToBoard(); mNetLines.append(netline);});
-    }
+        mNetLinesByUuid.remove(netline->getUuid());
+        removedNetLines.insert(netline);
+        sgl.add([this, netline](){
+            netline->addToBoard();
+            mNetLinesByUuid.insert(netline->getUuid(), netline);
+        });
+    }
+    QSet<BI_NetPoint*> removedNetPoints;
     foreach (BI_NetPoint* netpoint, netpoints) {
-        if (!mNetPoints.contains(netpoint)) {
+        if (getNetPointByUuid(netpoint->getUuid()) != netpoint) {
             throw LogicError(__FILE__, __LINE__);
         }
         // remove from board
         netpoint->removeFromBoard(); // can throw
-        mNetPoints.removeOne(netpoint);
-        sgl.add([this, netpoint](){netpoint->addToBoard(); mNetPoints.append(netpoint);});
-    }
+        mNetPointsByUuid.remove(netpoint->getUuid());
+        removedNetPoints.insert(netpoint);
+        sgl.add([this, netpoint](){
+            netpoint->addToBoard();
+            mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+        });
+    }
+    QSet<BI_Via*> removedVias;
     foreach (BI_Via* via, vias) {
-        if (!mVias.contains(via)) {
+        if (getViaByUuid(via->getUuid()) != via) {
             throw LogicError(__FILE__, __LINE__);
         }
         // remove from board
         via->removeFromBoard(); // can throw
-        mVias.removeOne(via);
-        sgl.add([this, via](){via->addToBoard(); mVias.append(via);});
-    }
+        mViasByUuid.remove(via->getUuid());
+        removedVias.insert(via);
+        sgl.add([this, via](){
+            via->addToBoard();
+            mViasByUuid.insert(via->getUuid(), via);
+        });
+    }
+
+    // remove all items from the lists at once, removing them one by one would take
+    // quadratic time when removing many items
+    QList<BI_Via*> viasBefore = mVias;
+    QList<BI_NetPoint*> netPointsBefore = mNetPoints;
+    QList<BI_NetLine*> netLinesBefore = mNetLines;
+    removeFromList(mNetLines, removedNetLines);
+    removeFromList(mNetPoints, removedNetPoints);
+    removeFromList(mVias, removedVias);
+    sgl.add([this, viasBefore, netPointsBefore, netLinesBefore](){
+        mVias = viasBefore;
+        mNetPoints = netPointsBefore;
+        mNetLines = netLinesBefore;
+    });
 
     if (!areAllNetPointsConnectedTogether()) {
         throw LogicError(__FILE__, __LINE__,
@@ -443,14 +484,27 @@ void BI_NetSegment::removeFromBoard()
     sgl.dismiss();
 }
 
+void BI_NetSegment::createGraphicsItems() noexcept
+{
+    foreach (BI_Via* via, mVias) {
+        via->createGraphicsItems();
+    }
+    foreach (BI_NetPoint* netpoint, mNetPoints) {
+        netpoint->createGraphicsItems();
+    }
+    foreach (BI_NetLine* netline, mNetLines) {
+        netline->createGraphicsItems();
+    }
+}
+
 void BI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept
 {
     foreach (BI_Via* via, mVias)
-        via->setSelected(via->isSelectable() && via->getGrabAreaScenePx().intersects(rectPx));
+        via->setSelected(via->isSelectable() && via->isGrabAreaIntersectingScenePx(rectPx));
     foreach (BI_NetPoint* netpoint, mNetPoints)
-        netpoint->setSelected(netpoint->isSelectable() && netpoint->getGrabAreaScenePx().intersects(rectPx));
+        netpoint->setSelected(netpoint->isSelectable() && netpoint->isGrabAreaIntersectingScenePx(rectPx));
     foreach (BI_NetLine* netline, mNetLines)
-        netline->setSelected(netline->isSelectable() && netline->getGrabAreaScenePx().intersects(rectPx));
+        netline->setSelected(netline->isSelectable() && netline->isGrabAreaIntersectingScenePx(rectPx));
 }
 
 void BI_NetSegment::clearSelection() const noexcept
@@ -512,32 +566,61 @@ bool BI_NetSegment::checkAttributesValidity() const noexcept
 bool BI_NetSegment::areAllNetPointsConnectedTogether() const noexcept
 {
     if (mNetPoints.count() > 1) {
-        const BI_NetPoint* firstPoint = mNetPoints.first();
-        QList<const BI_NetPoint*> points({firstPoint});
-        findAllConnectedNetPoints(*firstPoint, points);
-        return (points.count() == mNetPoints.count());
+        bool complete = false;
+        QVector<QVector<int>> adjacency = buildNetPointAdjacencyList(&complete);
+        if (!complete) return false; // there are netlines to foreign netpoints
+        return (Toolbox::findConnectedNodes(adjacency, 0).count() == mNetPoints.count());
     } else {
         return true; // there is only 0 or 1 netpoint => must be "connected together" :)
     }
 }
 
-void BI_NetSegment::findAllConnectedNetPoints(const BI_NetPoint& p, QList<const BI_NetPoint*>& points) const noexcept
+template <typename T>
+void BI_NetSegment::removeFromList(QList<T*>& list, const QSet<T*>& items) noexcept
 {
-    if (p.isAttachedToVia()) { Q_ASSERT(p.getVia());
-        foreach (const BI_NetPoint* np, mNetPoints) {
-            if ((np->getVia() == p.getVia()) && (!points.contains(np))) {
-                points.append(np);
-                findAllConnectedNetPoints(*np, points);
-            }
-        }
+    auto end = std::remove_if(list.begin(), list.end(),
+                              [&items](T* item){return items.contains(item);});
+    list.erase(end, list.end());
+}
+
+QVector<QVector<int>> BI_NetSegment::buildNetPointAdjacencyList(bool* complete) const noexcept
+{
+    QHash<const BI_NetPoint*, int> indices;
+    indices.reserve(mNetPoints.count());
+    for (int i = 0; i < mNetPoints.count(); ++i) {
+        indices.insert(mNetPoints.at(i), i);
     }
+
+    QVector<QVector<int>> adjacency(mNetPoints.count());
+    if (complete) *complete = true;
+
+    // netlines connect their start and end points
     foreach (const BI_NetLine* line, mNetLines) {
-        const BI_NetPoint* p2 = line->getOtherPoint(p);
-        if ((p2) && (!points.contains(p2))) {
-            points.append(p2);
-            findAllConnectedNetPoints(*p2, points);
+        int start = indices.value(&line->getStartPoint(), -1);
+        int end = indices.value(&line->getEndPoint(), -1);
+        if ((start >= 0) && (end >= 0)) {
+            adjacency[start].append(end);
+            adjacency[end].append(start);
+        } else if (complete) {
+            *complete = false;
         }
     }
+
+    // all netpoints attached to the same via are connected together (through the first one)
+    QHash<const BI_Via*, int> viaNetPoints;
+    for (int i = 0; i < mNetPoints.count(); ++i) {
+        const BI_Via* via = mNetPoints.at(i)->isAttachedToVia() ? mNetPoints.at(i)->getVia() : nullptr;
+        if (!via) continue;
+        int first = viaNetPoints.value(via, -1);
+        if (first >= 0) {
+            adjacency[first].append(i);
+            adjacency[i].append(first);
+        } else {
+            viaNetPoints.insert(via, i);
+        }
+    }
+
+    return adjacency;
 }
 
 /*****************************************************************************************
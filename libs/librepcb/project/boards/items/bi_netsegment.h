@@ -101,6 +101,7 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void setSelectionRect(const QRectF rectPx) noexcept;
         void clearSelection() const noexcept;
 
@@ -125,7 +126,9 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
     private:
         bool checkAttributesValidity() const noexcept;
         bool areAllNetPointsConnectedTogether() const noexcept;
-        void findAllConnectedNetPoints(const BI_NetPoint& p, QList<const BI_NetPoint*>& points) const noexcept;
+        QVector<QVector<int>> buildNetPointAdjacencyList(bool* complete = nullptr) const noexcept;
+        template <typename T>
+        static void removeFromList(QList<T*>& list, const QSet<T*>& items) noexcept;
 
 
         // Attributes
@@ -136,6 +139,11 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
         QList<BI_Via*> mVias;
         QList<BI_NetPoint*> mNetPoints;
         QList<BI_NetLine*> mNetLines;
+
+        // UUID indices of the items above (must always contain the same items!)
+        QHash<Uuid, BI_Via*> mViasByUuid;
+        QHash<Uuid, BI_NetPoint*> mNetPointsByUuid;
+        QHash<Uuid, BI_NetLine*> mNetLinesByUuid;
 };
 
 /*****************************************************************************************
@@ -22,12 +22,15 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "bi_plane.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../circuit/netsignal.h"
 #include "../graphicsitems/bgi_plane.h"
 #include "../boardplanefragmentsbuilder.h"
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/toolbox.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -94,9 +97,9 @@ BI_Plane::BI_Plane(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Plane::init()
 {
-    mGraphicsItem.reset(new BGI_Plane(*this));
-    mGraphicsItem->setPos(getPosition().toPxQPointF());
-    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Plane::boardAttributesChanged);
@@ -115,7 +118,7 @@ void BI_Plane::setOutline(const Path& outline) noexcept
 {
     if (outline != mOutline) {
         mOutline = outline;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -123,7 +126,7 @@ void BI_Plane::setLayerName(const QString& layerName) noexcept
 {
     if (layerName != mLayerName) {
         mLayerName = layerName;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -189,7 +192,7 @@ void BI_Plane::addToBoard()
     }
     mNetSignal->registerBoardPlane(*this); // can throw
     BI_Base::addToBoard(mGraphicsItem.data());
-    mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
     mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
@@ -203,17 +206,26 @@ void BI_Plane::removeFromBoard()
     mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
+void BI_Plane::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_Plane(*this));
+    mGraphicsItem->setPos(getPosition().toPxQPointF());
+    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_Plane::clear() noexcept
 {
     mFragments.clear();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Plane::rebuild() noexcept
 {
     BoardPlaneFragmentsBuilder builder(*this);
     mFragments = builder.buildFragments();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
@@ -245,18 +257,34 @@ void BI_Plane::serialize(SExpression& root) const
 
 QPainterPath BI_Plane::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        // same shape as the one of librepcb::project::BGI_Plane
+        return Toolbox::shapeFromPath(mOutline.toQPainterPathPx(true),
+                                      QPen(Length::fromMm(0.3).toPx()), QBrush());
+    }
+}
+
+QRectF BI_Plane::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_Plane::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    const GraphicsLayer* layer = mBoard.getLayerStack().getLayer(mLayerName);
+    return layer && layer->isVisible();
 }
 
 void BI_Plane::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -281,7 +309,7 @@ bool BI_Plane::operator<(const BI_Plane& rhs) const noexcept
 
 void BI_Plane::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*****************************************************************************************
@@ -100,6 +100,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
         void clear() noexcept;
         void rebuild() noexcept;
 
@@ -111,6 +112,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         const Point& getPosition() const noexcept override {static Point p(0, 0); return p;}
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
@@ -28,6 +28,7 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/polygongraphicsitem.h>
 #include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/toolbox.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -40,21 +41,21 @@ namespace project {
  ****************************************************************************************/
 
 BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mPolygon.reset(new Polygon(Uuid::createRandom(), *other.mPolygon));
     init();
 }
 
 BI_Polygon::BI_Polygon(Board& board, const SExpression& node) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mPolygon.reset(new Polygon(node));
     init();
 }
 
 BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mPolygon.reset(new Polygon(polygon));
     init();
@@ -62,7 +63,7 @@ BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon) :
 
 BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid, const QString& layerName, const Length& lineWidth, bool fill,
                        bool isGrabArea, const Path& path) :
-    BI_Base(board)
+    BI_Base(board), mGrabAreaValid(false)
 {
     mPolygon.reset(new Polygon(uuid, layerName, lineWidth, fill, isGrabArea, path));
     init();
@@ -70,8 +71,11 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Polygon::init()
 {
-    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
-    mGraphicsItem->setZValue(Board::ZValue_Default);
+    mPolygon->registerObserver(*this);
+
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Polygon::boardAttributesChanged);
@@ -80,6 +84,7 @@ void BI_Polygon::init()
 BI_Polygon::~BI_Polygon() noexcept
 {
     mGraphicsItem.reset();
+    mPolygon->unregisterObserver(*this);
     mPolygon.reset();
 }
 
@@ -103,6 +108,16 @@ void BI_Polygon::removeFromBoard()
     BI_Base::removeFromBoard(mGraphicsItem.data());
 }
 
+void BI_Polygon::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
+    mGraphicsItem->setZValue(Board::ZValue_Default);
+    mGraphicsItem->setSelected(isSelected());
+    addCreatedGraphicsItem(*mGraphicsItem);
+    mGrabAreaValid = false;
+}
+
 void BI_Polygon::serialize(SExpression& root) const
 {
     mPolygon->serialize(root);
@@ -114,7 +129,14 @@ void BI_Polygon::serialize(SExpression& root) const
 
 QPainterPath BI_Polygon::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaScenePx;
+}
+
+QRectF BI_Polygon::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaBoundingRectScenePx;
 }
 
 const Uuid& BI_Polygon::getUuid() const noexcept
@@ -131,7 +153,7 @@ bool BI_Polygon::isSelectable() const noexcept
 void BI_Polygon::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
 }
 
 /*****************************************************************************************
@@ -140,7 +162,27 @@ void BI_Polygon::setSelected(bool selected) noexcept
 
 void BI_Polygon::boardAttributesChanged()
 {
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BI_Polygon::updateGrabAreaCache() const noexcept
+{
+    if (mGraphicsItem) {
+        mGrabAreaScenePx = mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    } else {
+        // same shape as the one of librepcb::PolygonGraphicsItem
+        QPen pen(QBrush(Qt::SolidPattern), mPolygon->getLineWidth().toPx());
+        QBrush brush((mPolygon->isFilled() || mPolygon->isGrabArea()) ? Qt::SolidPattern
+                                                                       : Qt::NoBrush);
+        mGrabAreaScenePx = Toolbox::shapeFromPath(mPolygon->getPath().toQPainterPathPx(),
+                                                  pen, brush, Length(200000));
+    }
+    mGrabAreaBoundingRectScenePx = mGrabAreaScenePx.controlPointRect();
+    mGrabAreaValid = true;
 }
 
 /*****************************************************************************************
@@ -27,14 +27,13 @@
 #include "bi_base.h"
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/geometry/polygon.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
  ****************************************************************************************/
 namespace librepcb {
 
-class Path;
-class Polygon;
 class PolygonGraphicsItem;
 
 namespace project {
@@ -50,10 +49,14 @@ class BGI_Polygon;
 /**
  * @brief The BI_Polygon class
  *
+ * The grab area in scene coordinates is cached and invalidated whenever the polygon
+ * changes.
+ *
  * @author ubruhin
  * @date 2016-01-12
  */
-class BI_Polygon final : public BI_Base, public SerializableObject
+class BI_Polygon final : public BI_Base, public SerializableObject,
+                         public IF_PolygonObserver
 {
         Q_OBJECT
 
@@ -78,6 +81,7 @@ class BI_Polygon final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -87,6 +91,7 @@ class BI_Polygon final : public BI_Base, public SerializableObject
         const Point& getPosition() const noexcept override {static Point p(0, 0); return p;}
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
@@ -100,11 +105,22 @@ class BI_Polygon final : public BI_Base, public SerializableObject
 
     private:
         void init();
+        void updateGrabAreaCache() const noexcept;
+        void polygonLayerNameChanged(const QString& newLayerName) noexcept override {Q_UNUSED(newLayerName); mGrabAreaValid = false;}
+        void polygonLineWidthChanged(const Length& newLineWidth) noexcept override {Q_UNUSED(newLineWidth); mGrabAreaValid = false;}
+        void polygonIsFilledChanged(bool newIsFilled) noexcept override {Q_UNUSED(newIsFilled); mGrabAreaValid = false;}
+        void polygonIsGrabAreaChanged(bool newIsGrabArea) noexcept override {Q_UNUSED(newIsGrabArea); mGrabAreaValid = false;}
+        void polygonPathChanged(const Path& newPath) noexcept override {Q_UNUSED(newPath); mGrabAreaValid = false;}
 
 
         // General
         QScopedPointer<Polygon> mPolygon;
         QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+
+        // Cached Attributes
+        mutable bool mGrabAreaValid;
+        mutable QPainterPath mGrabAreaScenePx;
+        mutable QRectF mGrabAreaBoundingRectScenePx;
 };
 
 /*****************************************************************************************
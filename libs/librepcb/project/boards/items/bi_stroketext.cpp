@@ -31,6 +31,7 @@
 #include <librepcb/common/graphics/linegraphicsitem.h>
 #include <librepcb/common/graphics/stroketextgraphicsitem.h>
 #include <librepcb/common/geometry/stroketext.h>
+#include <librepcb/common/toolbox.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -43,14 +44,14 @@ namespace project {
  ****************************************************************************************/
 
 BI_StrokeText::BI_StrokeText(Board& board, const BI_StrokeText& other) :
-    BI_Base(board), mFootprint(nullptr)
+    BI_Base(board), mFootprint(nullptr), mGrabAreaValid(false)
 {
     mText.reset(new StrokeText(Uuid::createRandom(), *other.mText));
     init();
 }
 
 BI_StrokeText::BI_StrokeText(Board& board, const SExpression& node) :
-    BI_Base(board), mFootprint(nullptr)
+    BI_Base(board), mFootprint(nullptr), mGrabAreaValid(false)
 {
     mText.reset(new StrokeText(node));
     init();
@@ -58,7 +59,7 @@ BI_StrokeText::BI_StrokeText(Board& board, const SExpression& node) :
 }
 
 BI_StrokeText::BI_StrokeText(Board& board, const StrokeText& text) :
-    BI_Base(board), mFootprint(nullptr)
+    BI_Base(board), mFootprint(nullptr), mGrabAreaValid(false)
 {
     mText.reset(new StrokeText(text));
     init();
@@ -70,9 +71,9 @@ void BI_StrokeText::init()
     mText->setAttributeProvider(&mBoard);
     mText->setFont(&getProject().getStrokeFonts().getFont(mBoard.getDefaultFontName())); // can throw
 
-    mGraphicsItem.reset(new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
-    mAnchorGraphicsItem.reset(new LineGraphicsItem());
-    updateGraphicsItems();
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_StrokeText::boardAttributesChanged);
@@ -98,6 +99,8 @@ void BI_StrokeText::setFootprint(BI_Footprint* footprint) noexcept
 
 void BI_StrokeText::updateGraphicsItems() noexcept
 {
+    if ((!mGraphicsItem) || (!mAnchorGraphicsItem)) return;
+
     // update z-value
     Board::ItemZValue zValue = Board::ZValue_Texts;
     if (GraphicsLayer::isTopLayer(mText->getLayerName())) {
@@ -123,7 +126,7 @@ void BI_StrokeText::addToBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     BI_Base::addToBoard(mGraphicsItem.data());
-    mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
+    if (mAnchorGraphicsItem) mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
 }
 
 void BI_StrokeText::removeFromBoard()
@@ -132,7 +135,19 @@ void BI_StrokeText::removeFromBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     BI_Base::removeFromBoard(mGraphicsItem.data());
-    mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+    if (mAnchorGraphicsItem) mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+}
+
+void BI_StrokeText::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack()));
+    mGraphicsItem->setSelected(isSelected());
+    mAnchorGraphicsItem.reset(new LineGraphicsItem());
+    updateGraphicsItems();
+    addCreatedGraphicsItem(*mGraphicsItem);
+    addCreatedGraphicsItem(*mAnchorGraphicsItem);
+    mGrabAreaValid = false;
 }
 
 void BI_StrokeText::serialize(SExpression& root) const
@@ -151,7 +166,14 @@ const Point& BI_StrokeText::getPosition() const noexcept
 
 QPainterPath BI_StrokeText::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaScenePx;
+}
+
+QRectF BI_StrokeText::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (!mGrabAreaValid) updateGrabAreaCache();
+    return mGrabAreaBoundingRectScenePx;
 }
 
 const Uuid& BI_StrokeText::getUuid() const noexcept
@@ -168,7 +190,7 @@ bool BI_StrokeText::isSelectable() const noexcept
 void BI_StrokeText::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) mGraphicsItem->setSelected(selected);
     updateGraphicsItems();
 }
 
@@ -178,7 +200,33 @@ void BI_StrokeText::setSelected(bool selected) noexcept
 
 void BI_StrokeText::boardAttributesChanged()
 {
-    mText->updatePaths();
+    mText->updatePathsIfAttributesChanged(); // only re-stroke if the text depends on it
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BI_StrokeText::updateGrabAreaCache() const noexcept
+{
+    if (mGraphicsItem) {
+        mGrabAreaScenePx = mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
+    } else {
+        // same shape as the one of librepcb::StrokeTextGraphicsItem
+        QPen pen(QBrush(Qt::SolidPattern), mText->getStrokeWidth().toPx());
+        QPainterPath shape = Toolbox::shapeFromPath(
+            Path::toQPainterPathPx(mText->getPaths()), pen, QBrush(), Length(200000));
+        qreal crossSize = Length(1000000).toPx();
+        shape.addRect(QRectF(-crossSize/2, -crossSize/2, crossSize, crossSize));
+        QTransform t;
+        if (mText->getMirrored()) t.scale(qreal(-1), qreal(1));
+        t.rotate(-mText->getRotation().toDeg());
+        t *= QTransform::fromTranslate(mText->getPosition().toPxQPointF().x(),
+                                       mText->getPosition().toPxQPointF().y());
+        mGrabAreaScenePx = t.map(shape);
+    }
+    mGrabAreaBoundingRectScenePx = mGrabAreaScenePx.controlPointRect();
+    mGrabAreaValid = true;
 }
 
 /*****************************************************************************************
@@ -50,6 +50,9 @@ class BI_Footprint;
 
 /**
  * @brief The BI_StrokeText class
+ *
+ * The grab area in scene coordinates is cached and invalidated whenever the text
+ * changes.
  */
 class BI_StrokeText final : public BI_Base, public SerializableObject,
                             public IF_StrokeTextObserver
@@ -78,6 +81,7 @@ class BI_StrokeText final : public BI_Base, public SerializableObject,
         void updateGraphicsItems() noexcept;
         void addToBoard() override;
         void removeFromBoard() override;
+        void createGraphicsItems() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -87,6 +91,7 @@ class BI_StrokeText final : public BI_Base, public SerializableObject,
         const Point& getPosition() const noexcept override;
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
+        QRectF getGrabAreaBoundingRectScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
         // Operator Overloadings
@@ -100,18 +105,19 @@ class BI_StrokeText final : public BI_Base, public SerializableObject,
     private: // Methods
         void init();
         void updatePaths() noexcept;
-        void strokeTextLayerNameChanged(const QString& newLayerName) noexcept override {Q_UNUSED(newLayerName); updateGraphicsItems();}
+        void updateGrabAreaCache() const noexcept;
+        void strokeTextLayerNameChanged(const QString& newLayerName) noexcept override {Q_UNUSED(newLayerName); mGrabAreaValid = false; updateGraphicsItems();}
         void strokeTextTextChanged(const QString& newText) noexcept override {Q_UNUSED(newText);}
-        void strokeTextPositionChanged(const Point& newPos) noexcept override {Q_UNUSED(newPos); updateGraphicsItems();}
-        void strokeTextRotationChanged(const Angle& newRot) noexcept override {Q_UNUSED(newRot);}
+        void strokeTextPositionChanged(const Point& newPos) noexcept override {Q_UNUSED(newPos); mGrabAreaValid = false; updateGraphicsItems();}
+        void strokeTextRotationChanged(const Angle& newRot) noexcept override {Q_UNUSED(newRot); mGrabAreaValid = false;}
         void strokeTextHeightChanged(const Length& newHeight) noexcept override {Q_UNUSED(newHeight);}
-        void strokeTextStrokeWidthChanged(const Length& newStrokeWidth) noexcept override {Q_UNUSED(newStrokeWidth);}
+        void strokeTextStrokeWidthChanged(const Length& newStrokeWidth) noexcept override {Q_UNUSED(newStrokeWidth); mGrabAreaValid = false;}
         void strokeTextLetterSpacingChanged(const StrokeTextSpacing& spacing) noexcept override {Q_UNUSED(spacing);}
         void strokeTextLineSpacingChanged(const StrokeTextSpacing& spacing) noexcept override {Q_UNUSED(spacing);}
         void strokeTextAlignChanged(const Alignment& newAlign) noexcept override {Q_UNUSED(newAlign);}
-        void strokeTextMirroredChanged(bool mirrored) noexcept override {Q_UNUSED(mirrored);}
+        void strokeTextMirroredChanged(bool mirrored) noexcept override {Q_UNUSED(mirrored); mGrabAreaValid = false;}
         void strokeTextAutoRotateChanged(bool newAutoRotate) noexcept override {Q_UNUSED(newAutoRotate);}
-        void strokeTextPathsChanged(const QVector<Path>& paths) noexcept override {Q_UNUSED(paths);}
+        void strokeTextPathsChanged(const QVector<Path>& paths) noexcept override {Q_UNUSED(paths); mGrabAreaValid = false;}
 
 
     private: // Data
@@ -119,6 +125,11 @@ class BI_StrokeText final : public BI_Base, public SerializableObject,
         QScopedPointer<StrokeText> mText;
         QScopedPointer<StrokeTextGraphicsItem> mGraphicsItem;
         QScopedPointer<LineGraphicsItem> mAnchorGraphicsItem;
+
+        // Cached Attributes
+        mutable bool mGrabAreaValid;
+        mutable QPainterPath mGrabAreaScenePx;
+        mutable QRectF mGrabAreaBoundingRectScenePx;
 };
 
 /*****************************************************************************************
@@ -83,9 +83,10 @@ BI_Via::BI_Via(BI_NetSegment& netsegment, const Point& position, Shape shape, co
 
 void BI_Via::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_Via(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    // create the graphics item (only if the board is already shown in a view)
+    if (mBoard.hasGraphicsItems()) {
+        createGraphicsItems();
+    }
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged,
@@ -148,7 +149,7 @@ void BI_Via::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
         updateNetPoints();
         mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
     }
@@ -158,7 +159,7 @@ void BI_Via::setShape(Shape shape) noexcept
 {
     if (shape != mShape) {
         mShape = shape;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -166,7 +167,7 @@ void BI_Via::setSize(const Length& size) noexcept
 {
     if (size != mSize) {
         mSize = size;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -174,7 +175,7 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
 {
     if (diameter != mDrillDiameter) {
         mDrillDiameter = diameter;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -189,7 +190,7 @@ void BI_Via::addToBoard()
     }
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     BI_Base::addToBoard(mGraphicsItem.data());
     mBoard.scheduleAirWiresRebuild(&getNetSignalOfNetSegment());
 }
@@ -213,7 +214,7 @@ void BI_Via::registerNetPoint(BI_NetPoint& netpoint)
     }
     mRegisteredNetPoints.insert(netpoint.getLayer().getName(), &netpoint);
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint)
@@ -223,7 +224,7 @@ void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint)
     }
     mRegisteredNetPoints.remove(netpoint.getLayer().getName());
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::updateNetPoints() const noexcept
@@ -233,6 +234,14 @@ void BI_Via::updateNetPoints() const noexcept
     }
 }
 
+void BI_Via::createGraphicsItems() noexcept
+{
+    if (mGraphicsItem) return;
+    mGraphicsItem.reset(new BGI_Via(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    addCreatedGraphicsItem(*mGraphicsItem);
+}
+
 void BI_Via::serialize(SExpression& root) const
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -255,18 +264,32 @@ void BI_Via::serialize(SExpression& root) const
 
 QPainterPath BI_Via::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShape();
+    } else {
+        return getSceneOutline().toQPainterPathPx();
+    }
+}
+
+QRectF BI_Via::getGrabAreaBoundingRectScenePx() const noexcept
+{
+    if (mGraphicsItem) {
+        return mGraphicsItem->getSceneShapeBoundingRect();
+    } else {
+        return BI_Base::getGrabAreaBoundingRectScenePx();
+    }
 }
 
 bool BI_Via::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    const GraphicsLayer* layer = mBoard.getLayerStack().getLayer(GraphicsLayer::sBoardViasTht);
+    return layer && layer->isVisible();
 }
 
 void BI_Via::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -275,7 +298,7 @@ void BI_Via::setSelected(bool selected) noexcept
 
 void BI_Via::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 bool BI_Via::checkAttributesValidity() const noexcept
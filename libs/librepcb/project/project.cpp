@@ -121,6 +121,11 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
             break;
         }
         case DirectoryLock::LockStatus::StaleLock: {
+            if (mIsReadOnly) {
+                // don't ask the user (also allows opening projects without any GUI), just
+                // open the project without restoring the last backup
+                break;
+            }
             // the application crashed while this project was open! ask the user what to do
             QMessageBox::StandardButton btn = QMessageBox::question(0, tr("Restore Project?"),
                 tr("It seems that the application was crashed while this project was open. "
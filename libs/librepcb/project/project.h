@@ -92,6 +92,7 @@ class Project final : public QObject, public AttributeProvider
          *
          * @param filepath      The filepath to the an existing *.lpp project file
          * @param readOnly      It true, the project will be opened in read-only mode
+         *                      (this never requires any user interaction)
          *
          * @throw Exception     If the project could not be opened successfully
          */
@@ -20,7 +20,9 @@ INCLUDEPATH += \
 SOURCES += \
     boards/board.cpp \
     boards/boardairwiresbuilder.cpp \
+    boards/boarddesignrulecheck.cpp \
     boards/boardfabricationoutputsettings.cpp \
+    boards/boardgeometrycache.cpp \
     boards/boardgerberexport.cpp \
     boards/boardlayerstack.cpp \
     boards/boardplanefragmentsbuilder.cpp \
@@ -134,7 +136,9 @@ SOURCES += \
 HEADERS += \
     boards/board.h \
     boards/boardairwiresbuilder.h \
+    boards/boarddesignrulecheck.h \
     boards/boardfabricationoutputsettings.h \
+    boards/boardgeometrycache.h \
     boards/boardgerberexport.h \
     boards/boardlayerstack.h \
     boards/boardplanefragmentsbuilder.h \
@@ -69,6 +69,7 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     mBoundingRect = QRectF();
     mShape = QPainterPath();
     mShape.setFillRule(Qt::WindingFill);
+    mPolygonPaths.clear();
 
     // cross rect
     QRectF crossRect(-4, -4, 8, 8);
@@ -81,6 +82,7 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
         qreal w = polygon.getLineWidth().toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
         if (polygon.isGrabArea()) mShape = mShape.united(polygonPath);
+        mPolygonPaths.append(polygonPath);
     }
 
     // texts
@@ -146,8 +148,21 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
 
+    // if the whole symbol is only a few pixels large, just draw its bounding rect
+    if ((!deviceIsPrinter) &&
+        (qMax(mBoundingRect.width(), mBoundingRect.height()) * lod < sMinVisibleSizePx))
+    {
+        layer = getLayer(GraphicsLayer::sSymbolOutlines);
+        if (layer && layer->isVisible()) {
+            painter->fillRect(mBoundingRect, QBrush(layer->getColor(selected), Qt::Dense5Pattern));
+        }
+        return;
+    }
+
     // draw all polygons
-    for (const Polygon& polygon : mLibSymbol.getPolygons()) {
+    for (int i = 0; i < mPolygonPaths.count(); ++i) {
+        const Polygon& polygon = *mLibSymbol.getPolygons().at(i);
+
         // set colors
         layer = getLayer(polygon.getLayerName());
         if (layer) {if (!layer->isVisible()) layer = nullptr;}
@@ -165,7 +180,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         painter->setBrush(layer ? QBrush(layer->getColor(selected), Qt::SolidPattern) : Qt::NoBrush);
 
         // draw polygon
-        painter->drawPath(polygon.getPath().toQPainterPathPx());
+        painter->drawPath(mPolygonPaths.at(i));
     }
 
     // draw all circles
@@ -200,6 +215,9 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
+        // skip sub-pixel texts
+        if ((!deviceIsPrinter) && (lod * text.getHeight().toPx() < sMinTextHeightPx)) continue;
+
         // get cached text properties
         const CachedTextProperties_t& props = mCachedTextProperties.value(&text);
         mFont.setPixelSize(props.fontPixelSize);
@@ -211,7 +229,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         painter->translate(-text.getPosition().toPxQPointF());
         painter->scale(props.scaleFactor, props.scaleFactor);
         if (props.rotate180) painter->rotate(180);
-        if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > 8))
+        if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > sMinReadableHeightPx))
         {
             // draw text
             painter->setPen(QPen(layer->getColor(selected), 0));
@@ -103,6 +103,12 @@ class SGI_Symbol final : public SGI_Base
         QRectF mBoundingRect;
         QPainterPath mShape;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+        QVector<QPainterPath> mPolygonPaths;    ///< same order as the library polygons
+
+        // Static Variables
+        static constexpr qreal sMinVisibleSizePx = 4;       ///< below: draw bounding rect
+        static constexpr qreal sMinTextHeightPx = 1;        ///< below: skip text
+        static constexpr qreal sMinReadableHeightPx = 8;    ///< below: draw text rect
 };
 
 /*****************************************************************************************
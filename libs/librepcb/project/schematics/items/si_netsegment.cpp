@@ -67,6 +67,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node) :
                     .arg(netpoint->getUuid().toStr()));
             }
             mNetPoints.append(netpoint);
+            mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
         }
 
         // Load all netlines
@@ -78,6 +79,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node) :
                     .arg(netline->getUuid().toStr()));
             }
             mNetLines.append(netline);
+            mNetLinesByUuid.insert(netline->getUuid(), netline);
         }
 
         // Load all netlabels
@@ -89,6 +91,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node) :
                     .arg(netlabel->getUuid().toStr()));
             }
             mNetLabels.append(netlabel);
+            mNetLabelsByUuid.insert(netlabel->getUuid(), netlabel);
         }
 
         if (mNetPoints.count() < 2) {
@@ -108,9 +111,9 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node) :
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
-        qDeleteAll(mNetLabels);         mNetLabels.clear();
-        qDeleteAll(mNetLines);          mNetLines.clear();
-        qDeleteAll(mNetPoints);         mNetPoints.clear();
+        qDeleteAll(mNetLabels);         mNetLabels.clear();     mNetLabelsByUuid.clear();
+        qDeleteAll(mNetLines);          mNetLines.clear();      mNetLinesByUuid.clear();
+        qDeleteAll(mNetPoints);         mNetPoints.clear();     mNetPointsByUuid.clear();
         throw; // ...and rethrow the exception
     }
 }
@@ -123,9 +126,9 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, NetSignal& signal) :
 SI_NetSegment::~SI_NetSegment() noexcept
 {
     // delete all items
-    qDeleteAll(mNetLabels);         mNetLabels.clear();
-    qDeleteAll(mNetLines);          mNetLines.clear();
-    qDeleteAll(mNetPoints);         mNetPoints.clear();
+    qDeleteAll(mNetLabels);         mNetLabels.clear();     mNetLabelsByUuid.clear();
+    qDeleteAll(mNetLines);          mNetLines.clear();      mNetLinesByUuid.clear();
+    qDeleteAll(mNetPoints);         mNetPoints.clear();     mNetPointsByUuid.clear();
 }
 
 /*****************************************************************************************
@@ -241,11 +244,7 @@ void SI_NetSegment::setNetSignal(NetSignal& netsignal)
 
 SI_NetPoint* SI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetPoint* netpoint, mNetPoints) {
-        if (netpoint->getUuid() == uuid)
-            return netpoint;
-    }
-    return nullptr;
+    return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 /*****************************************************************************************
@@ -254,11 +253,7 @@ SI_NetPoint* SI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept
 
 SI_NetLine* SI_NetSegment::getNetLineByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetLine* netline, mNetLines) {
-        if (netline->getUuid() == uuid)
-            return netline;
-    }
-    return nullptr;
+    return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 /*****************************************************************************************
@@ -274,7 +269,8 @@ void SI_NetSegment::addNetPointsAndNetLines(const QList<SI_NetPoint*>& netpoints
 
     ScopeGuardList sgl(netpoints.count() + netlines.count());
     foreach (SI_NetPoint* netpoint, netpoints) {
-        if ((mNetPoints.contains(netpoint)) || (&netpoint->getNetSegment() != this)) {
+        if ((getNetPointByUuid(netpoint->getUuid()) == netpoint) ||
+            (&netpoint->getNetSegment() != this)) {
             throw LogicError(__FILE__, __LINE__);
         }
         // check if there is no netpoint with the same uuid in the list
@@ -286,10 +282,16 @@ void SI_NetSegment::addNetPointsAndNetLines(const QList<SI_NetPoint*>& netpoints
         // add to schematic
         netpoint->addToSchematic(); // can throw
         mNetPoints.append(netpoint);
-        sgl.add([this, netpoint](){netpoint->removeFromSchematic(); mNetPoints.removeOne(netpoint);});
+        mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+        sgl.add([this, netpoint](){
+            netpoint->removeFromSchematic();
+            mNetPoints.removeOne(netpoint);
+            mNetPointsByUuid.remove(netpoint->getUuid());
+        });
     }
     foreach (SI_NetLine* netline, netlines) {
-        if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+        if ((getNetLineByUuid(netline->getUuid()) == netline) ||
+            (&netline->getNetSegment() != this)) {
             throw LogicError(__FILE__, __LINE__);
         }
         // check if there is no netline with the same uuid in the list
@@ -301,7 +303,12 @@ void SI_NetSegment::addNetPointsAndNetLines(const QList<SI_NetPoint*>& netpoints
         // add to schematic
         netline->addToSchematic(); // can throw
         mNetLines.append(netline);
-        sgl.add([this, netline](){netline->removeFromSchematic(); mNetLines.removeOne(netline);});
+        mNetLinesByUuid.insert(netline->getUuid(), netline);
+        sgl.add([this, netline](){
+            netline->removeFromSchematic();
+            mNetLines.removeOne(netline);
+            mNetLinesByUuid.remove(netline->getUuid());
+        });
     }
 
     if (!areAllNetPointsConnectedTogether()) {
@@ -324,22 +331,32 @@ void SI_NetSegment::removeNetPointsAndNetLines(const QList<SI_NetPoint*>& netpoi
 
     ScopeGuardList sgl(netpoints.count() + netlines.count());
     foreach (SI_NetLine* netline, netlines) {
-        if (!mNetLines.contains(netline)) {
+        if (getNetLineByUuid(netline->getUuid()) != netline) {
             throw LogicError(__FILE__, __LINE__);
         }
         // remove from schematic
         netline->removeFromSchematic(); // can throw
         mNetLines.removeOne(netline);
-        sgl.add([this, netline](){netline->addToSchematic(); mNetLines.append(netline);});
+        mNetLinesByUuid.remove(netline->getUuid());
+        sgl.add([this, netline](){
+            netline->addToSchematic();
+            mNetLines.append(netline);
+            mNetLinesByUuid.insert(netline->getUuid(), netline);
+        });
     }
     foreach (SI_NetPoint* netpoint, netpoints) {
-        if (!mNetPoints.contains(netpoint)) {
+        if (getNetPointByUuid(netpoint->getUuid()) != netpoint) {
             throw LogicError(__FILE__, __LINE__);
         }
         // remove from schematic
         netpoint->removeFromSchematic(); // can throw
         mNetPoints.removeOne(netpoint);
-        sgl.add([this, netpoint](){netpoint->addToSchematic(); mNetPoints.append(netpoint);});
+        mNetPointsByUuid.remove(netpoint->getUuid());
+        sgl.add([this, netpoint](){
+            netpoint->addToSchematic();
+            mNetPoints.append(netpoint);
+            mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+        });
     }
 
     if (!areAllNetPointsConnectedTogether()) {
@@ -359,16 +376,12 @@ void SI_NetSegment::removeNetPointsAndNetLines(const QList<SI_NetPoint*>& netpoi
 
 SI_NetLabel* SI_NetSegment::getNetLabelByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetLabel* netlabel, mNetLabels) {
-        if (netlabel->getUuid() == uuid)
-            return netlabel;
-    }
-    return nullptr;
+    return mNetLabelsByUuid.value(uuid, nullptr);
 }
 
 void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel)
 {
-    if ((!isAddedToSchematic()) || (mNetLabels.contains(&netlabel))
+    if ((!isAddedToSchematic()) || (getNetLabelByUuid(netlabel.getUuid()) == &netlabel)
         || (&netlabel.getNetSegment() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -382,16 +395,18 @@ void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel)
     // add to schematic
     netlabel.addToSchematic(); // can throw
     mNetLabels.append(&netlabel);
+    mNetLabelsByUuid.insert(netlabel.getUuid(), &netlabel);
 }
 
 void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel)
 {
-    if ((!isAddedToSchematic()) || (!mNetLabels.contains(&netlabel))) {
+    if ((!isAddedToSchematic()) || (getNetLabelByUuid(netlabel.getUuid()) != &netlabel)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netlabel.removeFromSchematic(); // can throw
     mNetLabels.removeOne(&netlabel);
+    mNetLabelsByUuid.remove(netlabel.getUuid());
 }
 
 void SI_NetSegment::updateAllNetLabelAnchors() noexcept
@@ -527,24 +542,39 @@ bool SI_NetSegment::checkAttributesValidity() const noexcept
 bool SI_NetSegment::areAllNetPointsConnectedTogether() const noexcept
 {
     if (mNetPoints.count() > 1) {
-        const SI_NetPoint* firstPoint = mNetPoints.first();
-        QList<const SI_NetPoint*> points({firstPoint});
-        findAllConnectedNetPoints(*firstPoint, points);
-        return (points.count() == mNetPoints.count());
+        bool complete = false;
+        QVector<QVector<int>> adjacency = buildNetPointAdjacencyList(&complete);
+        if (!complete) return false; // there are netlines to foreign netpoints
+        return (Toolbox::findConnectedNodes(adjacency, 0).count() == mNetPoints.count());
     } else {
         return true; // there is only 0 or 1 netpoint => must be "connected together" :)
     }
 }
 
-void SI_NetSegment::findAllConnectedNetPoints(const SI_NetPoint& p, QList<const SI_NetPoint*>& points) const noexcept
+QVector<QVector<int>> SI_NetSegment::buildNetPointAdjacencyList(bool* complete) const noexcept
 {
+    QHash<const SI_NetPoint*, int> indices;
+    indices.reserve(mNetPoints.count());
+    for (int i = 0; i < mNetPoints.count(); ++i) {
+        indices.insert(mNetPoints.at(i), i);
+    }
+
+    QVector<QVector<int>> adjacency(mNetPoints.count());
+    if (complete) *complete = true;
+
+    // netlines connect their start and end points
     foreach (const SI_NetLine* line, mNetLines) {
-        const SI_NetPoint* p2 = line->getOtherPoint(p);
-        if ((p2) && (!points.contains(p2))) {
-            points.append(p2);
-            findAllConnectedNetPoints(*p2, points);
+        int start = indices.value(&line->getStartPoint(), -1);
+        int end = indices.value(&line->getEndPoint(), -1);
+        if ((start >= 0) && (end >= 0)) {
+            adjacency[start].append(end);
+            adjacency[end].append(start);
+        } else if (complete) {
+            *complete = false;
         }
     }
+
+    return adjacency;
 }
 
 /*****************************************************************************************
@@ -121,7 +121,7 @@ class SI_NetSegment final : public SI_Base, public SerializableObject
     private:
         bool checkAttributesValidity() const noexcept;
         bool areAllNetPointsConnectedTogether() const noexcept;
-        void findAllConnectedNetPoints(const SI_NetPoint& p, QList<const SI_NetPoint*>& points) const noexcept;
+        QVector<QVector<int>> buildNetPointAdjacencyList(bool* complete = nullptr) const noexcept;
 
 
         // Attributes
@@ -132,6 +132,11 @@ class SI_NetSegment final : public SI_Base, public SerializableObject
         QList<SI_NetPoint*> mNetPoints;
         QList<SI_NetLine*> mNetLines;
         QList<SI_NetLabel*> mNetLabels;
+
+        // UUID indices of the items above (must always contain the same items!)
+        QHash<Uuid, SI_NetPoint*> mNetPointsByUuid;
+        QHash<Uuid, SI_NetLine*> mNetLinesByUuid;
+        QHash<Uuid, SI_NetLabel*> mNetLabelsByUuid;
 };
 
 /*****************************************************************************************
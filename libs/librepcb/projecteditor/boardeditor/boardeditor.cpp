@@ -171,7 +171,11 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
             [this](){mFsm->processEvent(new BEE_Base(BEE_Base::Edit_Remove), true);});
 
     // setup status bar
-    mUi->statusbar->setFields(StatusBar::AbsolutePosition | StatusBar::ProgressBar);
+    StatusBar::Fields statusBarFields = StatusBar::AbsolutePosition | StatusBar::ProgressBar;
+    if (mProjectEditor.getWorkspace().getSettings().getDebugTools().getShowFrameTime()) {
+        statusBarFields |= StatusBar::FrameTime;
+    }
+    mUi->statusbar->setFields(statusBarFields);
     mUi->statusbar->setProgressBarTextFormat(tr("Scanning libraries (%p%)"));
     connect(&mProjectEditor.getWorkspace().getLibraryDb(), &workspace::WorkspaceLibraryDb::scanStarted,
             mUi->statusbar, &StatusBar::showProgressBar, Qt::QueuedConnection);
@@ -181,6 +185,8 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
             mUi->statusbar, &StatusBar::setProgressBarPercent, Qt::QueuedConnection);
     connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
             mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
+    connect(mGraphicsView, &GraphicsView::frameRendered,
+            mUi->statusbar, &StatusBar::setFrameTime);
 
     // Restore Window Geometry
     QSettings clientSettings;
@@ -73,8 +73,13 @@ FabricationOutputDialog::FabricationOutputDialog(Board& board, QWidget *parent)
     mUi->edtSuffixSolderPasteTop->setText(s.getSuffixSolderPasteTop());
     mUi->edtSuffixSolderPasteBot->setText(s.getSuffixSolderPasteBot());
     mUi->cbxDrillsMerge->setChecked(s.getMergeDrillFiles());
+    mUi->cbxDrillsOptimize->setChecked(s.getOptimizeDrillOrder());
     mUi->cbxSolderPasteTop->setChecked(s.getEnableSolderPasteTop());
     mUi->cbxSolderPasteBot->setChecked(s.getEnableSolderPasteBot());
+    mUi->spbPanelColumns->setValue(s.getPanelColumns());
+    mUi->spbPanelRows->setValue(s.getPanelRows());
+    mUi->spbPanelPitchX->setValue(s.getPanelPitch().getX().toMm());
+    mUi->spbPanelPitchY->setValue(s.getPanelPitch().getY().toMm());
 
     QStringList topSilkscreen = s.getSilkscreenLayersTop();
     mUi->cbxSilkTopPlacement->setChecked(topSilkscreen.contains(GraphicsLayer::sTopPlacement));
@@ -158,8 +163,13 @@ void FabricationOutputDialog::on_btnGenerate_clicked()
         s.setSilkscreenLayersTop(getTopSilkscreenLayers());
         s.setSilkscreenLayersBot(getBotSilkscreenLayers());
         s.setMergeDrillFiles(mUi->cbxDrillsMerge->isChecked());
+        s.setOptimizeDrillOrder(mUi->cbxDrillsOptimize->isChecked());
         s.setEnableSolderPasteTop(mUi->cbxSolderPasteTop->isChecked());
         s.setEnableSolderPasteBot(mUi->cbxSolderPasteBot->isChecked());
+        s.setPanelColumns(mUi->spbPanelColumns->value());
+        s.setPanelRows(mUi->spbPanelRows->value());
+        s.setPanelPitch(Point(Length::fromMm(mUi->spbPanelPitchX->value()),
+                              Length::fromMm(mUi->spbPanelPitchY->value())));
         if (s != mBoard.getFabricationOutputSettings()) {
             mBoard.getFabricationOutputSettings() = s; // TODO: use undo command
         }
@@ -36,6 +36,7 @@
 #include "workspacelibrarydb.h"
 #include "../workspace.h"
 #include "workspacelibraryscanner.h"
+#include "workspacelibrarywatcher.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -50,7 +51,7 @@ using namespace library;
  ****************************************************************************************/
 
 WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
-    QObject(nullptr), mWorkspace(ws)
+    QObject(nullptr), mWorkspace(ws), mScanInProgress(false)
 {
     qDebug("Load workspace library database...");
 
@@ -69,6 +70,16 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
         setDbVersion(sCurrentDbVersion); // can throw
     }
 
+    // invalidate the cache as soon as a rescan starts and don't fill it again until the
+    // rescan has finished, otherwise lookups could return results from before the rescan
+    // (these connections must be made before anyone else connects to the scan signals)
+    connect(this, &WorkspaceLibraryDb::scanStarted,
+            this, &WorkspaceLibraryDb::scanStartedHandler);
+    connect(this, &WorkspaceLibraryDb::scanSucceeded,
+            this, &WorkspaceLibraryDb::scanFinishedHandler);
+    connect(this, &WorkspaceLibraryDb::scanFailed,
+            this, &WorkspaceLibraryDb::scanFinishedHandler);
+
     // create library scanner object
     mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace));
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::started,
@@ -80,6 +91,13 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::failed,
             this, &WorkspaceLibraryDb::scanFailed, Qt::QueuedConnection);
 
+    // create file system watcher (disabled by default)
+    mLibraryWatcher.reset(new WorkspaceLibraryWatcher(mWorkspace));
+    connect(mLibraryWatcher.data(), &WorkspaceLibraryWatcher::elementsChanged,
+            mLibraryScanner.data(), &WorkspaceLibraryScanner::startElementsScan);
+    connect(mLibraryWatcher.data(), &WorkspaceLibraryWatcher::librariesChanged,
+            this, &WorkspaceLibraryDb::watchedLibrariesChanged);
+
     qDebug("Workspace library database successfully loaded!");
 }
 
@@ -127,32 +145,32 @@ QMultiMap<Version, FilePath> WorkspaceLibraryDb::getDevices(const Uuid& uuid) co
 
 FilePath WorkspaceLibraryDb::getLatestComponentCategory(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getComponentCategories(uuid));
+    return getLatestElementFilePath("component_categories", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestPackageCategory(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getPackageCategories(uuid));
+    return getLatestElementFilePath("package_categories", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestSymbol(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getSymbols(uuid));
+    return getLatestElementFilePath("symbols", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestPackage(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getPackages(uuid));
+    return getLatestElementFilePath("packages", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestComponent(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getComponents(uuid));
+    return getLatestElementFilePath("components", uuid);
 }
 
 FilePath WorkspaceLibraryDb::getLatestDevice(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getDevices(uuid));
+    return getLatestElementFilePath("devices", uuid);
 }
 
 /*****************************************************************************************
@@ -257,6 +275,15 @@ void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid
     if (pkgUuid) *pkgUuid = uuid;
 }
 
+/*****************************************************************************************
+ *  Getters: General
+ ****************************************************************************************/
+
+bool WorkspaceLibraryDb::isFileSystemWatcherEnabled() const noexcept
+{
+    return mLibraryWatcher->isEnabled();
+}
+
 /*****************************************************************************************
  *  Getters: Special
  ****************************************************************************************/
@@ -346,46 +373,124 @@ QSet<Uuid> WorkspaceLibraryDb::getComponentsBySearchKeyword(const QString& keywo
     return elements;
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void WorkspaceLibraryDb::setFileSystemWatcherEnabled(bool enabled) noexcept
+{
+    mLibraryWatcher->setEnabled(enabled);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void WorkspaceLibraryDb::startLibraryRescan() noexcept
 {
-    mLibraryScanner->start();
+    mLibraryWatcher->updateWatchedDirectories(); // libraries may have been added/removed
+    scanStartedHandler(); // don't wait for the (queued) scanStarted() signal
+    mLibraryScanner->startFullScan();
+}
+
+void WorkspaceLibraryDb::clearCache() noexcept
+{
+    mLatestElementCache.clear();
+    mTranslationsCache.clear();
+    mCategoryChildsCache.clear();
+    mCategoryParentsCache.clear();
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+void WorkspaceLibraryDb::scanStartedHandler() noexcept
+{
+    mScanInProgress = true;
+    clearCache();
+}
+
+void WorkspaceLibraryDb::scanFinishedHandler() noexcept
+{
+    mScanInProgress = false;
+    clearCache();
+}
+
+void WorkspaceLibraryDb::watchedLibrariesChanged(const QSet<FilePath>& libDirs) noexcept
+{
+    // adding or removing a library triggers a full rescan by the workspace
+    foreach (const FilePath& libDir, libDirs) {
+        QString name = libDir.getFilename();
+        bool remote = (libDir.getParentDir().getFilename() == "remote");
+        bool valid = Library::isValidElementDirectory<Library>(libDir);
+        try {
+            if (valid && remote) {
+                mWorkspace.addRemoteLibrary(name); // can throw
+            } else if (valid) {
+                mWorkspace.addLocalLibrary(name); // can throw
+            } else if (remote) {
+                mWorkspace.removeRemoteLibrary(name, false); // can throw
+            } else {
+                mWorkspace.removeLocalLibrary(name, false); // can throw
+            }
+        } catch (const Exception& e) {
+            qWarning() << "Failed to update workspace library" << libDir.toNative()
+                       << ":" << e.getMsg();
+        }
+    }
+}
+
+FilePath WorkspaceLibraryDb::getLatestElementFilePath(const QString& tablename,
+                                                      const Uuid& uuid) const
+{
+    QHash<Uuid, FilePath>& cache = mLatestElementCache[tablename];
+    auto it = cache.constFind(uuid);
+    if (it != cache.constEnd()) {
+        return *it;
+    }
+    FilePath fp = getLatestVersionFilePath(getElementFilePathsFromDb(tablename, uuid)); // can throw
+    if (!mScanInProgress) cache.insert(uuid, fp);
+    return fp;
+}
+
 void WorkspaceLibraryDb::getElementTranslations(const QString& table,
     const QString& idRow, const FilePath& elemDir, const QStringList& localeOrder,
     QString* name, QString* desc, QString* keywords) const
 {
-    QSqlQuery query = mDb->prepareQuery(
-        "SELECT locale, name, description, keywords FROM " % table % "_tr "
-        "INNER JOIN " % table % " ON " % table % ".id=" % table % "_tr." % idRow % " "
-        "WHERE " % table % ".filepath = :filepath");
-    query.bindValue(":filepath", elemDir.toRelative(mWorkspace.getLibrariesPath()));
-    mDb->exec(query);
+    QString relativeFilePath = elemDir.toRelative(mWorkspace.getLibrariesPath());
+    QHash<QString, ElementTranslations>& cache = mTranslationsCache[table];
+    auto it = cache.constFind(relativeFilePath);
+    if (it == cache.constEnd()) {
+        QSqlQuery query = mDb->prepareQuery(
+            "SELECT locale, name, description, keywords FROM " % table % "_tr "
+            "INNER JOIN " % table % " ON " % table % ".id=" % table % "_tr." % idRow % " "
+            "WHERE " % table % ".filepath = :filepath");
+        query.bindValue(":filepath", relativeFilePath);
+        mDb->exec(query);
 
-    LocalizedNameMap nameMap;
-    LocalizedDescriptionMap descriptionMap;
-    LocalizedKeywordsMap keywordsMap;
-    while (query.next()) {
-        QString locale      = query.value(0).toString();
-        QString name        = query.value(1).toString();
-        QString description = query.value(2).toString();;
-        QString keywords    = query.value(3).toString();
-        if (!name.isNull())          nameMap.insert(locale, name);
-        if (!description.isNull())   descriptionMap.insert(locale, description);
-        if (!keywords.isNull())      keywordsMap.insert(locale, keywords);
+        ElementTranslations translations;
+        while (query.next()) {
+            QString locale      = query.value(0).toString();
+            QString name        = query.value(1).toString();
+            QString description = query.value(2).toString();;
+            QString keywords    = query.value(3).toString();
+            if (!name.isNull())          translations.names.insert(locale, name);
+            if (!description.isNull())   translations.descriptions.insert(locale, description);
+            if (!keywords.isNull())      translations.keywords.insert(locale, keywords);
+        }
+        if (mScanInProgress) {
+            if (name) *name = translations.names.value(localeOrder);
+            if (desc) *desc = translations.descriptions.value(localeOrder);
+            if (keywords) *keywords = translations.keywords.value(localeOrder);
+            return;
+        }
+        it = cache.insert(relativeFilePath, translations);
     }
 
-    if (name) *name = nameMap.value(localeOrder);
-    if (desc) *desc = descriptionMap.value(localeOrder);
-    if (keywords) *keywords = keywordsMap.value(localeOrder);
+    if (name) *name = it->names.value(localeOrder);
+    if (desc) *desc = it->descriptions.value(localeOrder);
+    if (keywords) *keywords = it->keywords.value(localeOrder);
 }
 
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
@@ -420,6 +525,12 @@ FilePath WorkspaceLibraryDb::getLatestVersionFilePath(const QMultiMap<Version, F
 
 QSet<Uuid> WorkspaceLibraryDb::getCategoryChilds(const QString& tablename, const Uuid& categoryUuid) const
 {
+    QHash<Uuid, QSet<Uuid>>& cache = mCategoryChildsCache[tablename];
+    auto it = cache.constFind(categoryUuid);
+    if (it != cache.constEnd()) {
+        return *it;
+    }
+
     QSqlQuery query = mDb->prepareQuery(
         "SELECT uuid FROM " % tablename % " WHERE parent_uuid " %
         (categoryUuid.isNull() ? QString("IS NULL") : "= '" % categoryUuid.toStr() % "'"));
@@ -434,20 +545,41 @@ QSet<Uuid> WorkspaceLibraryDb::getCategoryChilds(const QString& tablename, const
             throw LogicError(__FILE__, __LINE__);
         }
     }
+    if (!mScanInProgress) cache.insert(categoryUuid, elements);
     return elements;
 }
 
 QList<Uuid> WorkspaceLibraryDb::getCategoryParents(const QString& tablename, Uuid category) const
 {
+    QHash<Uuid, QList<Uuid>>& cache = mCategoryParentsCache[tablename];
+    auto it = cache.constFind(category);
+    if (it != cache.constEnd()) {
+        return *it;
+    }
+
+    Uuid originalCategory = category;
     QList<Uuid> parentUuids;
     while (!(category = getCategoryParent(tablename, category)).isNull()) {
         if (parentUuids.contains(category)) {
             throw RuntimeError(__FILE__, __LINE__, QString(tr("Endless loop "
                 "in category parentship detected (%1).")).arg(category.toStr()));
-        } else {
+        }
+        // the parents of an already cached category are known, no more queries needed
+        auto parentIt = cache.constFind(category);
+        if (parentIt != cache.constEnd()) {
             parentUuids.append(category);
+            foreach (const Uuid& uuid, *parentIt) {
+                if (parentUuids.contains(uuid)) {
+                    throw RuntimeError(__FILE__, __LINE__, QString(tr("Endless loop "
+                        "in category parentship detected (%1).")).arg(uuid.toStr()));
+                }
+                parentUuids.append(uuid);
+            }
+            break;
         }
+        parentUuids.append(category);
     }
+    if (!mScanInProgress) cache.insert(originalCategory, parentUuids);
     return parentUuids;
 }
 
@@ -27,6 +27,7 @@
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/fileio/serializablekeyvaluemap.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -40,6 +41,7 @@ namespace workspace {
 
 class Workspace;
 class WorkspaceLibraryScanner;
+class WorkspaceLibraryWatcher;
 
 /*****************************************************************************************
  *  Class WorkspaceLibraryDb
@@ -47,6 +49,16 @@ class WorkspaceLibraryScanner;
 
 /**
  * @brief The WorkspaceLibraryDb class
+ *
+ * All lookups by UUID (latest element file paths, element translations and the category
+ * tree) are served from an in-memory cache after the first query. The cache is
+ * invalidated when a library rescan starts and again when it has finished. While a
+ * rescan is running, lookups are not cached at all, so they never outlive the scan.
+ *
+ * Optionally, a file system watcher (see #setFileSystemWatcherEnabled()) keeps the
+ * database up to date by rescanning only modified library elements, and by adding
+ * libraries to (or removing them from) the workspace as soon as their directories
+ * appear in (or disappear from) "libraries/local" or "libraries/remote".
  */
 class WorkspaceLibraryDb final : public QObject
 {
@@ -96,6 +108,9 @@ class WorkspaceLibraryDb final : public QObject
                                     QString* keywords = nullptr) const;
         void getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid = nullptr) const;
 
+        // Getters: General
+        bool isFileSystemWatcherEnabled() const noexcept;
+
         // Getters: Special
         QSet<Uuid> getComponentCategoryChilds(const Uuid& parent) const;
         QSet<Uuid> getPackageCategoryChilds(const Uuid& parent) const;
@@ -108,6 +123,9 @@ class WorkspaceLibraryDb final : public QObject
         QSet<Uuid> getDevicesOfComponent(const Uuid& component) const;
         QSet<Uuid> getComponentsBySearchKeyword(const QString& keyword) const;
 
+        // Setters
+        void setFileSystemWatcherEnabled(bool enabled) noexcept;
+
         // General Methods
 
         /**
@@ -115,6 +133,14 @@ class WorkspaceLibraryDb final : public QObject
          */
         void startLibraryRescan() noexcept;
 
+        /**
+         * @brief Clear the in-memory cache of all database queries
+         *
+         * This is done automatically when a library rescan starts and finishes, so
+         * normally there is no need to call this method manually.
+         */
+        void clearCache() noexcept;
+
         // Operator Overloadings
         WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
 
@@ -129,7 +155,18 @@ class WorkspaceLibraryDb final : public QObject
 
     private:
 
+        // Types
+        struct ElementTranslations {
+            LocalizedNameMap names;
+            LocalizedDescriptionMap descriptions;
+            LocalizedKeywordsMap keywords;
+        };
+
         // Private Methods
+        void scanStartedHandler() noexcept;
+        void scanFinishedHandler() noexcept;
+        void watchedLibrariesChanged(const QSet<FilePath>& libDirs) noexcept;
+        FilePath getLatestElementFilePath(const QString& tablename, const Uuid& uuid) const;
         void getElementTranslations(const QString& table, const QString& idRow,
                                     const FilePath& elemDir, const QStringList& localeOrder,
                                     QString* name, QString* desc, QString* keywords) const;
@@ -152,6 +189,14 @@ class WorkspaceLibraryDb final : public QObject
         Workspace& mWorkspace;
         QScopedPointer<SQLiteDatabase> mDb; ///< the SQLite database "cache.sqlite"
         QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+        QScopedPointer<WorkspaceLibraryWatcher> mLibraryWatcher;
+        bool mScanInProgress; ///< if true, lookups are not written into the cache
+
+        // Cache (key of the outer hashes is always the table name)
+        mutable QHash<QString, QHash<Uuid, FilePath>> mLatestElementCache;
+        mutable QHash<QString, QHash<QString, ElementTranslations>> mTranslationsCache;
+        mutable QHash<QString, QHash<Uuid, QSet<Uuid>>> mCategoryChildsCache;
+        mutable QHash<QString, QHash<Uuid, QList<Uuid>>> mCategoryParentsCache;
 
         // Constants
         static const int sCurrentDbVersion = 1;
@@ -39,8 +39,11 @@ using namespace library;
  ****************************************************************************************/
 
 WorkspaceLibraryScanner::WorkspaceLibraryScanner(Workspace& ws) noexcept :
-    QThread(nullptr), mWorkspace(ws), mAbort(false)
+    QThread(nullptr), mWorkspace(ws), mAbort(false), mFullScanRequested(false)
 {
+    // process requests which were made while the previous scan was running
+    connect(this, &QThread::finished, this, &WorkspaceLibraryScanner::startPendingScan,
+            Qt::QueuedConnection);
 }
 
 WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept
@@ -55,6 +58,27 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WorkspaceLibraryScanner::startFullScan() noexcept
+{
+    QMutexLocker locker(&mMutex);
+    mFullScanRequested = true;
+    mRequestedElementDirs.clear(); // a full scan covers them anyway
+    start(); // does nothing if the thread is already running
+}
+
+void WorkspaceLibraryScanner::startElementsScan(const QSet<FilePath>& dirs) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (!mFullScanRequested) {
+        mRequestedElementDirs.unite(dirs);
+    }
+    start(); // does nothing if the thread is already running
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -63,12 +87,22 @@ void WorkspaceLibraryScanner::run() noexcept
 {
     try {
         mAbort = false;
-        emit started();
 
-        // get a list of all available libraries
-        QList<QSharedPointer<library::Library>> libraries;
-        libraries.append(mWorkspace.getLocalLibraries().values());
-        libraries.append(mWorkspace.getRemoteLibraries().values());
+        // take all pending requests
+        bool fullScan;
+        QSet<FilePath> elementDirs;
+        {
+            QMutexLocker locker(&mMutex);
+            fullScan = mFullScanRequested;
+            elementDirs = mRequestedElementDirs;
+            mFullScanRequested = false;
+            mRequestedElementDirs.clear();
+        }
+        if ((!fullScan) && elementDirs.isEmpty()) {
+            return; // nothing to do
+        }
+
+        emit started();
 
         // open SQLite database
         FilePath dbFilePath = mWorkspace.getLibrariesPath().getPathTo("cache.sqlite");
@@ -77,39 +111,8 @@ void WorkspaceLibraryScanner::run() noexcept
         // begin database transaction
         SQLiteDatabase::TransactionScopeGuard transactionGuard(db); // can throw
 
-        // clear all tables
-        clearAllTables(db);
-
-        // scan all libraries
-        int count = 0;
-        qreal percent = 0;
-        foreach (const QSharedPointer<Library>& lib, libraries) {
-            int libId = addLibraryToDb(db, lib);
-            if (mAbort) break;
-            count += addCategoriesToDb<ComponentCategory>(db, lib->searchForElements<ComponentCategory>(),
-                                                          "component_categories", "cat_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addCategoriesToDb<PackageCategory>(db, lib->searchForElements<PackageCategory>(),
-                                                        "package_categories", "cat_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Symbol>(db, lib->searchForElements<Symbol>(),
-                                             "symbols", "symbol_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Package>(db, lib->searchForElements<Package>(),
-                                              "packages", "package_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Component>(db, lib->searchForElements<Component>(),
-                                                "components", "component_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addDevicesToDb(db, lib->searchForElements<Device>(),
-                                    "devices", "device_id", libId);
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-        }
+        // scan libraries
+        int count = fullScan ? scanAllLibraries(db) : scanElements(db, elementDirs); // can throw
 
         // commit transaction
         if (!mAbort) {
@@ -121,6 +124,111 @@ void WorkspaceLibraryScanner::run() noexcept
     }
 }
 
+void WorkspaceLibraryScanner::startPendingScan() noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (mFullScanRequested || (!mRequestedElementDirs.isEmpty())) {
+        start();
+    }
+}
+
+int WorkspaceLibraryScanner::scanAllLibraries(SQLiteDatabase& db)
+{
+    // get a list of all available libraries
+    QList<QSharedPointer<library::Library>> libraries;
+    libraries.append(mWorkspace.getLocalLibraries().values());
+    libraries.append(mWorkspace.getRemoteLibraries().values());
+
+    // clear all tables
+    clearAllTables(db);
+
+    // scan all libraries
+    int count = 0;
+    qreal percent = 0;
+    foreach (const QSharedPointer<Library>& lib, libraries) {
+        int libId = addLibraryToDb(db, lib);
+        if (mAbort) break;
+        QHash<QString, QList<FilePath>> elements = lib->searchForAllElements();
+        count += addCategoriesToDb<ComponentCategory>(db,
+            elements.value(ComponentCategory::getShortElementName()),
+            "component_categories", "cat_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+        if (mAbort) break;
+        count += addCategoriesToDb<PackageCategory>(db,
+            elements.value(PackageCategory::getShortElementName()),
+            "package_categories", "cat_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+        if (mAbort) break;
+        count += addElementsToDb<Symbol>(db, elements.value(Symbol::getShortElementName()),
+                                         "symbols", "symbol_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+        if (mAbort) break;
+        count += addElementsToDb<Package>(db, elements.value(Package::getShortElementName()),
+                                          "packages", "package_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+        if (mAbort) break;
+        count += addElementsToDb<Component>(db, elements.value(Component::getShortElementName()),
+                                            "components", "component_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+        if (mAbort) break;
+        count += addDevicesToDb(db, elements.value(Device::getShortElementName()),
+                                "devices", "device_id", libId);
+        emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+    }
+    return count;
+}
+
+int WorkspaceLibraryScanner::scanElements(SQLiteDatabase& db, const QSet<FilePath>& dirs)
+{
+    int count = 0;
+    int processed = 0;
+    foreach (const FilePath& dir, dirs) {
+        if (mAbort) break;
+        // element directories are always located in "<library>/<element type>/<uuid>"
+        QString type = dir.getParentDir().getFilename();
+        int libId = getLibraryId(db, dir.getParentDir().getParentDir());
+        if (libId < 0) {
+            qWarning() << "Library of element not found in database:" << dir.toNative();
+        } else if (type == ComponentCategory::getShortElementName()) {
+            removeElementFromDb(db, dir, "component_categories", "cat_id", false);
+            if (Library::isValidElementDirectory<ComponentCategory>(dir)) {
+                count += addCategoriesToDb<ComponentCategory>(db, {dir},
+                    "component_categories", "cat_id", libId);
+            }
+        } else if (type == PackageCategory::getShortElementName()) {
+            removeElementFromDb(db, dir, "package_categories", "cat_id", false);
+            if (Library::isValidElementDirectory<PackageCategory>(dir)) {
+                count += addCategoriesToDb<PackageCategory>(db, {dir},
+                    "package_categories", "cat_id", libId);
+            }
+        } else if (type == Symbol::getShortElementName()) {
+            removeElementFromDb(db, dir, "symbols", "symbol_id", true);
+            if (Library::isValidElementDirectory<Symbol>(dir)) {
+                count += addElementsToDb<Symbol>(db, {dir}, "symbols", "symbol_id", libId);
+            }
+        } else if (type == Package::getShortElementName()) {
+            removeElementFromDb(db, dir, "packages", "package_id", true);
+            if (Library::isValidElementDirectory<Package>(dir)) {
+                count += addElementsToDb<Package>(db, {dir}, "packages", "package_id", libId);
+            }
+        } else if (type == Component::getShortElementName()) {
+            removeElementFromDb(db, dir, "components", "component_id", true);
+            if (Library::isValidElementDirectory<Component>(dir)) {
+                count += addElementsToDb<Component>(db, {dir}, "components", "component_id", libId);
+            }
+        } else if (type == Device::getShortElementName()) {
+            removeElementFromDb(db, dir, "devices", "device_id", true);
+            if (Library::isValidElementDirectory<Device>(dir)) {
+                count += addDevicesToDb(db, {dir}, "devices", "device_id", libId);
+            }
+        } else {
+            qWarning() << "Directory is not a library element directory:" << dir.toNative();
+        }
+        emit progressUpdate(100 * (++processed) / dirs.count());
+    }
+    return count;
+}
+
 void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db)
 {
     // libraries
@@ -156,6 +264,40 @@ void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db)
     db.clearTable("devices");
 }
 
+void WorkspaceLibraryScanner::removeElementFromDb(SQLiteDatabase& db, const FilePath& dir,
+    const QString& table, const QString& idColumn, bool hasCategories)
+{
+    QSqlQuery query = db.prepareQuery(
+        "SELECT id FROM " % table % " WHERE filepath = :filepath");
+    query.bindValue(":filepath", dir.toRelative(mWorkspace.getLibrariesPath()));
+    db.exec(query);
+    if (!query.next()) {
+        return; // element is not in the database
+    }
+    int id = query.value(0).toInt();
+
+    QStringList queries;
+    queries << QString("DELETE FROM " % table % "_tr WHERE " % idColumn % " = :id");
+    if (hasCategories) {
+        queries << QString("DELETE FROM " % table % "_cat WHERE " % idColumn % " = :id");
+    }
+    queries << QString("DELETE FROM " % table % " WHERE id = :id");
+    foreach (const QString& string, queries) {
+        QSqlQuery query = db.prepareQuery(string);
+        query.bindValue(":id", id);
+        db.exec(query);
+    }
+}
+
+int WorkspaceLibraryScanner::getLibraryId(SQLiteDatabase& db, const FilePath& libDir)
+{
+    QSqlQuery query = db.prepareQuery(
+        "SELECT id FROM libraries WHERE filepath = :filepath");
+    query.bindValue(":filepath", libDir.toRelative(mWorkspace.getLibrariesPath()));
+    db.exec(query);
+    return query.next() ? query.value(0).toInt() : -1;
+}
+
 int WorkspaceLibraryScanner::addLibraryToDb(SQLiteDatabase& db,
                                             const QSharedPointer<library::Library>& lib)
 {
@@ -229,7 +371,9 @@ int WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db, const QList<Fil
     foreach (const FilePath& filepath, dirs) {
         if (mAbort) break;
         try {
-            ElementType element(filepath, true); // can throw
+            // only the metadata is needed, so skip loading all the geometry etc.
+            LibraryElement element(filepath, ElementType::getShortElementName(),
+                                   ElementType::getLongElementName(), true, true); // can throw
             QSqlQuery query = db.prepareQuery(
                 "INSERT INTO " % table % " "
                 "(lib_id, filepath, uuid, version) VALUES "
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -49,6 +50,12 @@ class Workspace;
 /**
  * @brief The WorkspaceLibraryScanner class
  *
+ * The scanner either rebuilds the whole library database (#startFullScan()) or only
+ * updates the entries of some specific library element directories
+ * (#startElementsScan()). Requests which arrive while a scan is running are queued and
+ * processed as soon as the running scan has finished. Every scan (full or incremental)
+ * emits #started() followed by either #succeeded() or #failed().
+ *
  * @warning Be very careful with dependencies to other objects as the #run() method is
  *          executed in a separate thread! Keep the number of dependencies as small as
  *          possible and consider thread synchronization and object lifetimes.
@@ -72,6 +79,23 @@ class WorkspaceLibraryScanner final : public QThread
         WorkspaceLibraryScanner(const WorkspaceLibraryScanner& other) = delete;
         ~WorkspaceLibraryScanner() noexcept;
 
+        // General Methods
+
+        /**
+         * @brief Rescan all libraries and rebuild the whole library database
+         */
+        void startFullScan() noexcept;
+
+        /**
+         * @brief Update the database entries of some library elements
+         *
+         * Elements which no longer exist are removed from the database, new or modified
+         * elements are (re-)added.
+         *
+         * @param dirs  The library element directories to update
+         */
+        void startElementsScan(const QSet<FilePath>& dirs) noexcept;
+
         // Operator Overloadings
         WorkspaceLibraryScanner& operator=(const WorkspaceLibraryScanner& rhs) = delete;
 
@@ -87,7 +111,14 @@ class WorkspaceLibraryScanner final : public QThread
     private: // Methods
 
         void run() noexcept override;
+        void startPendingScan() noexcept;
+        int scanAllLibraries(SQLiteDatabase& db);
+        int scanElements(SQLiteDatabase& db, const QSet<FilePath>& dirs);
         void clearAllTables(SQLiteDatabase& db);
+        void removeElementFromDb(SQLiteDatabase& db, const FilePath& dir,
+                                 const QString& table, const QString& idColumn,
+                                 bool hasCategories);
+        int getLibraryId(SQLiteDatabase& db, const FilePath& libDir);
         int addLibraryToDb(SQLiteDatabase& db, const QSharedPointer<library::Library>& lib);
         template <typename ElementType>
         int addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
@@ -103,6 +134,11 @@ class WorkspaceLibraryScanner final : public QThread
 
         Workspace& mWorkspace;
         volatile bool mAbort;
+
+        // Pending scan requests (protected by #mMutex)
+        QMutex mMutex;
+        bool mFullScanRequested;
+        QSet<FilePath> mRequestedElementDirs;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,317 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "workspacelibrarywatcher.h"
+#include <librepcb/library/elements.h>
+#include "../workspace.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+WorkspaceLibraryWatcher::WorkspaceLibraryWatcher(const Workspace& ws) noexcept :
+    QObject(nullptr), mWorkspace(ws)
+{
+    mDebounceTimer.setSingleShot(true);
+    mDebounceTimer.setInterval(sDefaultDebounceInterval);
+    connect(&mDebounceTimer, &QTimer::timeout,
+            this, &WorkspaceLibraryWatcher::debounceTimerTimeout);
+}
+
+WorkspaceLibraryWatcher::~WorkspaceLibraryWatcher() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void WorkspaceLibraryWatcher::setEnabled(bool enabled) noexcept
+{
+    if (enabled && (!mWatcher)) {
+        mWatcher.reset(new QFileSystemWatcher());
+        connect(mWatcher.data(), &QFileSystemWatcher::directoryChanged,
+                this, &WorkspaceLibraryWatcher::directoryChanged);
+        updateWatchedDirectories();
+    } else if ((!enabled) && mWatcher) {
+        mWatcher.reset();
+        mLibraryRootDirectories.clear();
+        mElementsDirectories.clear();
+        mElementDirectories.clear();
+        mChangedElementDirs.clear();
+        mChangedLibraryDirs.clear();
+        mDebounceTimer.stop();
+    }
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WorkspaceLibraryWatcher::updateWatchedDirectories() noexcept
+{
+    if (!mWatcher) return;
+
+    QStringList oldPaths = mWatcher->directories();
+    if (!oldPaths.isEmpty()) mWatcher->removePaths(oldPaths);
+    mLibraryRootDirectories.clear();
+    mElementsDirectories.clear();
+    mElementDirectories.clear();
+
+    // watch all directories in "local" and "remote", not only the valid libraries, since
+    // a new library directory may become valid later (e.g. while it is being cloned)
+    QList<FilePath> rootDirs = {
+        mWorkspace.getLibrariesPath().getPathTo("local"),
+        mWorkspace.getLibrariesPath().getPathTo("remote")
+    };
+    foreach (const FilePath& rootDir, rootDirs) {
+        if (!rootDir.isExistingDir()) continue;
+        QStringList names = getSubDirectoryNames(rootDir);
+        mLibraryRootDirectories.insert(rootDir, names);
+        watchDirectories({rootDir});
+        foreach (const QString& name, names) {
+            watchLibraryDirectory(rootDir.getPathTo(name), false);
+        }
+    }
+    qDebug() << "Library file system watcher watches" << mWatcher->directories().count()
+             << "directories.";
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void WorkspaceLibraryWatcher::directoryChanged(const QString& path) noexcept
+{
+    FilePath dir(path);
+    if (mLibraryRootDirectories.contains(dir)) {
+        // libraries were added to or removed from "local" or "remote"
+        libraryRootDirectoryChanged(dir);
+    } else if (mElementsDirectories.contains(dir)) {
+        // elements were added to or removed from an element type directory
+        elementsDirectoryChanged(dir);
+    } else if (mElementDirectories.contains(dir)) {
+        // files of an element were added, removed or replaced (or the element was removed)
+        scheduleElementChanged(dir);
+    } else if (mLibraryRootDirectories.contains(dir.getParentDir())) {
+        // a library directory was modified, maybe an element type directory was added or
+        // the library became valid
+        if (!dir.isExistingDir()) {
+            return; // handled by libraryRootDirectoryChanged()
+        } else if (isWorkspaceLibrary(dir)) {
+            watchLibraryDirectory(dir, true);
+        } else {
+            watchLibraryDirectory(dir, false);
+            scheduleLibraryChanged(dir);
+        }
+    }
+}
+
+void WorkspaceLibraryWatcher::debounceTimerTimeout() noexcept
+{
+    if (!mChangedLibraryDirs.isEmpty()) {
+        QSet<FilePath> dirs = mChangedLibraryDirs;
+        mChangedLibraryDirs.clear();
+        qDebug() << "Library file system watcher detected" << dirs.count()
+                 << "added or removed libraries.";
+        emit librariesChanged(dirs);
+    }
+    if (!mChangedElementDirs.isEmpty()) {
+        QSet<FilePath> dirs = mChangedElementDirs;
+        mChangedElementDirs.clear();
+        qDebug() << "Library file system watcher detected" << dirs.count()
+                 << "modified elements.";
+        emit elementsChanged(dirs);
+    }
+}
+
+void WorkspaceLibraryWatcher::libraryRootDirectoryChanged(const FilePath& rootDir) noexcept
+{
+    QSet<QString> oldNames = mLibraryRootDirectories.value(rootDir).toSet();
+    QStringList newNames = getSubDirectoryNames(rootDir);
+    mLibraryRootDirectories.insert(rootDir, newNames);
+    foreach (const QString& name, newNames) {
+        if (!oldNames.remove(name)) {
+            FilePath libDir = rootDir.getPathTo(name);
+            watchLibraryDirectory(libDir, false); // all elements are scanned when added
+            scheduleLibraryChanged(libDir);
+        }
+    }
+    foreach (const QString& name, oldNames) { // all remaining names were removed
+        FilePath libDir = rootDir.getPathTo(name);
+        unwatchDirectory(libDir);
+        scheduleLibraryChanged(libDir);
+    }
+}
+
+void WorkspaceLibraryWatcher::elementsDirectoryChanged(const FilePath& elementsDir) noexcept
+{
+    QSet<QString> oldNames = mElementsDirectories.value(elementsDir).toSet();
+    QStringList newNames = getSubDirectoryNames(elementsDir);
+    mElementsDirectories.insert(elementsDir, newNames);
+    QList<FilePath> addedDirs;
+    foreach (const QString& name, newNames) {
+        if (!oldNames.remove(name)) {
+            FilePath elementDir = elementsDir.getPathTo(name);
+            addedDirs.append(elementDir);
+            scheduleElementChanged(elementDir);
+        }
+    }
+    watchDirectories(addedDirs);
+    foreach (const QString& name, oldNames) { // all remaining names were removed
+        FilePath elementDir = elementsDir.getPathTo(name);
+        unwatchDirectory(elementDir);
+        scheduleElementChanged(elementDir);
+    }
+}
+
+void WorkspaceLibraryWatcher::watchLibraryDirectory(const FilePath& libDir,
+                                                    bool reportElements) noexcept
+{
+    QList<FilePath> dirsToWatch;
+    if (!mWatcher->directories().contains(libDir.toStr())) {
+        dirsToWatch.append(libDir);
+    }
+
+    QStringList elementTypes = {
+        ComponentCategory::getShortElementName(), PackageCategory::getShortElementName(),
+        Symbol::getShortElementName(), Package::getShortElementName(),
+        Component::getShortElementName(), Device::getShortElementName()
+    };
+    foreach (const QString& elementType, elementTypes) {
+        FilePath elementsDir = libDir.getPathTo(elementType);
+        if (mElementsDirectories.contains(elementsDir) || (!elementsDir.isExistingDir())) {
+            continue;
+        }
+        QStringList names = getSubDirectoryNames(elementsDir);
+        mElementsDirectories.insert(elementsDir, names);
+        dirsToWatch.append(elementsDir);
+        foreach (const QString& name, names) {
+            FilePath elementDir = elementsDir.getPathTo(name);
+            dirsToWatch.append(elementDir);
+            if (reportElements) {
+                scheduleElementChanged(elementDir);
+            }
+        }
+    }
+    watchDirectories(dirsToWatch);
+}
+
+void WorkspaceLibraryWatcher::watchDirectories(const QList<FilePath>& dirs) noexcept
+{
+    if (dirs.isEmpty()) return;
+
+    // add all paths at once, which is much faster than adding them one by one
+    QStringList paths;
+    paths.reserve(dirs.count());
+    foreach (const FilePath& dir, dirs) {
+        paths.append(dir.toStr());
+        if (mElementsDirectories.contains(dir.getParentDir())) {
+            mElementDirectories.insert(dir);
+        }
+    }
+    QStringList failedPaths = mWatcher->addPaths(paths);
+    if (!failedPaths.isEmpty()) {
+        qWarning() << "Library file system watcher failed to watch" << failedPaths.count()
+                   << "directories, e.g." << QDir::toNativeSeparators(failedPaths.first());
+    }
+}
+
+void WorkspaceLibraryWatcher::unwatchDirectory(const FilePath& dir) noexcept
+{
+    // forget the directory itself and all directories within it
+    QStringList paths;
+    foreach (const QString& path, mWatcher->directories()) {
+        FilePath fp(path);
+        if ((fp == dir) || fp.isLocatedInDir(dir)) {
+            paths.append(path);
+        }
+    }
+    if (!paths.isEmpty()) mWatcher->removePaths(paths);
+    foreach (const FilePath& fp, mElementsDirectories.keys()) {
+        if ((fp == dir) || fp.isLocatedInDir(dir)) {
+            mElementsDirectories.remove(fp);
+        }
+    }
+    for (auto it = mElementDirectories.begin(); it != mElementDirectories.end();) {
+        if ((*it == dir) || it->isLocatedInDir(dir)) {
+            it = mElementDirectories.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void WorkspaceLibraryWatcher::scheduleElementChanged(const FilePath& elementDir) noexcept
+{
+    mChangedElementDirs.insert(elementDir);
+    restartDebounceTimer();
+}
+
+void WorkspaceLibraryWatcher::scheduleLibraryChanged(const FilePath& libDir) noexcept
+{
+    mChangedLibraryDirs.insert(libDir);
+    restartDebounceTimer();
+}
+
+void WorkspaceLibraryWatcher::restartDebounceTimer() noexcept
+{
+    if (!mDebounceTimer.isActive()) {
+        mPendingSince.start();
+        mDebounceTimer.start();
+    } else if (mPendingSince.elapsed() < sMaximumDelay) {
+        // restart the timer, but don't postpone the rescan forever on continuous
+        // modifications
+        mDebounceTimer.start();
+    }
+}
+
+bool WorkspaceLibraryWatcher::isWorkspaceLibrary(const FilePath& libDir) const noexcept
+{
+    QString name = libDir.getFilename();
+    if (libDir.getParentDir().getFilename() == "local") {
+        return mWorkspace.getLocalLibraries().contains(name);
+    } else {
+        return mWorkspace.getRemoteLibraries().contains(name);
+    }
+}
+
+QStringList WorkspaceLibraryWatcher::getSubDirectoryNames(const FilePath& dir) const noexcept
+{
+    return QDir(dir.toStr()).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
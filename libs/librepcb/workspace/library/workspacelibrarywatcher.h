@@ -0,0 +1,166 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WORKSPACE_WORKSPACELIBRARYWATCHER_H
+#define LIBREPCB_WORKSPACE_WORKSPACELIBRARYWATCHER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+class Workspace;
+
+/*****************************************************************************************
+ *  Class WorkspaceLibraryWatcher
+ ****************************************************************************************/
+
+/**
+ * @brief The WorkspaceLibraryWatcher class watches the workspace libraries for added,
+ *        removed and modified libraries and library elements
+ *
+ * The directories "libraries/local" and "libraries/remote", all library directories
+ * within them, their element type subdirectories (e.g. "sym") and all element
+ * directories are watched with a QFileSystemWatcher. This way the following
+ * modifications are detected:
+ *
+ *  - Libraries added to or removed from "libraries/local" or "libraries/remote"
+ *    (reported with #librariesChanged()).
+ *  - Element directories added to or removed from a library (reported with
+ *    #elementsChanged()).
+ *  - Files created, removed, renamed or replaced within an element directory, e.g. by
+ *    "git pull" or by saving with QSaveFile (reported with #elementsChanged()). Note that
+ *    files which are overwritten in place are not detected since directory watches
+ *    don't report content modifications of the contained files.
+ *
+ * All modifications are accumulated and reported as soon as no more changes were
+ * detected for the debounce interval (or the maximum delay has elapsed). This way,
+ * bursts of file modifications (e.g. a "git pull" of a library) lead to only one
+ * (incremental) library rescan.
+ */
+class WorkspaceLibraryWatcher final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        WorkspaceLibraryWatcher() = delete;
+        WorkspaceLibraryWatcher(const WorkspaceLibraryWatcher& other) = delete;
+        explicit WorkspaceLibraryWatcher(const Workspace& ws) noexcept;
+        ~WorkspaceLibraryWatcher() noexcept;
+
+        // Getters
+        bool isEnabled() const noexcept {return !mWatcher.isNull();}
+        int getDebounceInterval() const noexcept {return mDebounceTimer.interval();}
+
+        // Setters
+        void setEnabled(bool enabled) noexcept;
+        void setDebounceInterval(int ms) noexcept {mDebounceTimer.setInterval(ms);}
+
+        // General Methods
+
+        /**
+         * @brief Update the list of watched directories
+         *
+         * Must be called after libraries were added to or removed from the workspace.
+         */
+        void updateWatchedDirectories() noexcept;
+
+        // Operator Overloadings
+        WorkspaceLibraryWatcher& operator=(const WorkspaceLibraryWatcher& rhs) = delete;
+
+
+    signals:
+
+        /**
+         * @brief Library element directories were added, removed or modified
+         *
+         * @param elementDirs   All affected element directories (which may not exist
+         *                      anymore)
+         */
+        void elementsChanged(const QSet<FilePath>& elementDirs);
+
+        /**
+         * @brief Directories were added to or removed from "libraries/local" or
+         *        "libraries/remote", or a not yet loaded library directory was modified
+         *
+         * @param libraryDirs   All affected library directories (which may not exist
+         *                      anymore, or may not be valid libraries (yet))
+         */
+        void librariesChanged(const QSet<FilePath>& libraryDirs);
+
+
+    private: // Methods
+        void directoryChanged(const QString& path) noexcept;
+        void debounceTimerTimeout() noexcept;
+        void libraryRootDirectoryChanged(const FilePath& rootDir) noexcept;
+        void elementsDirectoryChanged(const FilePath& elementsDir) noexcept;
+        void watchLibraryDirectory(const FilePath& libDir, bool reportElements) noexcept;
+        void watchDirectories(const QList<FilePath>& dirs) noexcept;
+        void unwatchDirectory(const FilePath& dir) noexcept;
+        void scheduleElementChanged(const FilePath& elementDir) noexcept;
+        void scheduleLibraryChanged(const FilePath& libDir) noexcept;
+        void restartDebounceTimer() noexcept;
+        bool isWorkspaceLibrary(const FilePath& libDir) const noexcept;
+        QStringList getSubDirectoryNames(const FilePath& dir) const noexcept;
+
+
+    private: // Data
+        const Workspace& mWorkspace;
+        QScopedPointer<QFileSystemWatcher> mWatcher;
+
+        /// The watched "libraries/local" and "libraries/remote" and their content
+        QHash<FilePath, QStringList> mLibraryRootDirectories;
+
+        /// All watched element type directories (e.g. "lib/sym") and their content
+        QHash<FilePath, QStringList> mElementsDirectories;
+
+        /// All watched element directories (e.g. "lib/sym/<uuid>")
+        QSet<FilePath> mElementDirectories;
+
+        /// All element directories which were modified since the last #elementsChanged()
+        QSet<FilePath> mChangedElementDirs;
+
+        /// All library directories which were modified since the last #librariesChanged()
+        QSet<FilePath> mChangedLibraryDirs;
+
+        QTimer mDebounceTimer;          ///< restarted on every file system modification
+        QElapsedTimer mPendingSince;    ///< to limit the delay of continuous modifications
+
+        // Constants
+        static const int sDefaultDebounceInterval = 1000; ///< [ms]
+        static const int sMaximumDelay = 10000; ///< [ms]
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WORKSPACE_WORKSPACELIBRARYWATCHER_H
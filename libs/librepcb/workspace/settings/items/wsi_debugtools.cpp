@@ -35,9 +35,11 @@ namespace workspace {
  ****************************************************************************************/
 
 WSI_DebugTools::WSI_DebugTools(const SExpression& node) :
-    WSI_Base()
+    WSI_Base(), mShowFrameTime(false), mShowFrameTimeCheckBox(nullptr)
 {
-    Q_UNUSED(node);
+    if (const SExpression* child = node.tryGetChildByPath("show_frame_time")) {
+        mShowFrameTime = child->getValueOfFirstChild<bool>(true);
+    }
 
     // create a QWidget
     mWidget.reset(new QWidget());
@@ -45,6 +47,10 @@ WSI_DebugTools::WSI_DebugTools(const SExpression& node) :
 #ifndef QT_DEBUG
     layout->addWidget(new QLabel(tr("Warning: Some of these settings may only work in DEBUG mode!")), 0, 0);
 #endif
+    mShowFrameTimeCheckBox = new QCheckBox(tr("Show frame render time in the status bar "
+                                              "(applied to newly opened windows)"));
+    mShowFrameTimeCheckBox->setChecked(mShowFrameTime);
+    layout->addWidget(mShowFrameTimeCheckBox, layout->rowCount(), 0);
 
     // stretch the last row
     layout->setRowStretch(layout->rowCount(), 1);
@@ -60,14 +66,17 @@ WSI_DebugTools::~WSI_DebugTools() noexcept
 
 void WSI_DebugTools::restoreDefault() noexcept
 {
+    mShowFrameTimeCheckBox->setChecked(false);
 }
 
 void WSI_DebugTools::apply() noexcept
 {
+    mShowFrameTime = mShowFrameTimeCheckBox->isChecked();
 }
 
 void WSI_DebugTools::revert() noexcept
 {
+    mShowFrameTimeCheckBox->setChecked(mShowFrameTime);
 }
 
 /*****************************************************************************************
@@ -76,7 +85,7 @@ void WSI_DebugTools::revert() noexcept
 
 void WSI_DebugTools::serialize(SExpression& root) const
 {
-    Q_UNUSED(root);
+    root.appendTokenChild("show_frame_time", mShowFrameTime, true);
 }
 
 /*****************************************************************************************
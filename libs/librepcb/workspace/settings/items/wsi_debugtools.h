@@ -50,6 +50,9 @@ class WSI_DebugTools final : public WSI_Base
         explicit WSI_DebugTools(const SExpression& node);
         ~WSI_DebugTools() noexcept;
 
+        // Getters
+        bool getShowFrameTime() const noexcept {return mShowFrameTime;}
+
         // Getters: Widgets
         QWidget* getWidget() const noexcept {return mWidget.data();}
 
@@ -67,8 +70,16 @@ class WSI_DebugTools final : public WSI_Base
 
     private: // Data
 
+        /**
+         * @brief Whether the render time of the graphics views is shown in the status bar
+         *
+         * Default: false
+         */
+        bool mShowFrameTime;
+
         // Widgets
         QScopedPointer<QWidget> mWidget;
+        QCheckBox* mShowFrameTimeCheckBox; ///< owned by #mWidget
 };
 
 /*****************************************************************************************
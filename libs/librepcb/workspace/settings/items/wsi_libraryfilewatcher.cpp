@@ -0,0 +1,90 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "wsi_libraryfilewatcher.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+WSI_LibraryFileWatcher::WSI_LibraryFileWatcher(const SExpression& node) :
+    WSI_Base(), mEnabled(false)
+{
+    if (const SExpression* child = node.tryGetChildByPath("library_file_watcher")) {
+        mEnabled = child->getValueOfFirstChild<bool>(true);
+    }
+
+    // create widgets
+    mCheckBox.reset(new QCheckBox(tr("Automatically update library database when "
+                                     "library files are modified")));
+    mCheckBox->setChecked(mEnabled);
+}
+
+WSI_LibraryFileWatcher::~WSI_LibraryFileWatcher() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WSI_LibraryFileWatcher::restoreDefault() noexcept
+{
+    mCheckBox->setChecked(false);
+}
+
+void WSI_LibraryFileWatcher::apply() noexcept
+{
+    if (mCheckBox->isChecked() != mEnabled) {
+        mEnabled = mCheckBox->isChecked();
+        emit enabledChanged(mEnabled);
+    }
+}
+
+void WSI_LibraryFileWatcher::revert() noexcept
+{
+    mCheckBox->setChecked(mEnabled);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void WSI_LibraryFileWatcher::serialize(SExpression& root) const
+{
+    root.appendTokenChild("library_file_watcher", mEnabled, true);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
@@ -0,0 +1,102 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WSI_LIBRARYFILEWATCHER_H
+#define LIBREPCB_WSI_LIBRARYFILEWATCHER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include "wsi_base.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class WSI_LibraryFileWatcher
+ ****************************************************************************************/
+
+/**
+ * @brief The WSI_LibraryFileWatcher class represents the setting whether the workspace
+ *        libraries are watched for modifications or not
+ *
+ * If enabled, the library database is updated automatically (and incrementally) as soon
+ * as library elements are added or removed by other applications (e.g. "git pull").
+ * Disabled by default.
+ */
+class WSI_LibraryFileWatcher final : public WSI_Base
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        WSI_LibraryFileWatcher() = delete;
+        WSI_LibraryFileWatcher(const WSI_LibraryFileWatcher& other) = delete;
+        explicit WSI_LibraryFileWatcher(const SExpression& node);
+        ~WSI_LibraryFileWatcher() noexcept;
+
+        // Getters
+        bool getEnabled() const noexcept {return mEnabled;}
+
+        // Getters: Widgets
+        QString getLabelText() const noexcept {return tr("File System Watcher:");}
+        QWidget* getWidget() const noexcept {return mCheckBox.data();}
+
+        // General Methods
+        void restoreDefault() noexcept override;
+        void apply() noexcept override;
+        void revert() noexcept override;
+
+        /// @copydoc librepcb::SerializableObject::serialize()
+        void serialize(SExpression& root) const override;
+
+        // Operator Overloadings
+        WSI_LibraryFileWatcher& operator=(const WSI_LibraryFileWatcher& rhs) = delete;
+
+
+    signals:
+
+        void enabledChanged(bool enabled);
+
+
+    private: // Data
+
+        /**
+         * @brief Whether the library file system watcher is enabled or not
+         *
+         * Default: false
+         */
+        bool mEnabled;
+
+        // Widgets
+        QScopedPointer<QCheckBox> mCheckBox;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WSI_LIBRARYFILEWATCHER_H
@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WSI_LIBRARYSNAPSHOT_H
+#define LIBREPCB_WSI_LIBRARYSNAPSHOT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include "wsi_base.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class WSI_LibrarySnapshot
+ ****************************************************************************************/
+
+/**
+ * @brief The WSI_LibrarySnapshot class represents the setting whether the parsed
+ *        workspace library elements are cached in a binary snapshot or not
+ *
+ * See librepcb::library::LibrarySnapshot for details. Disabled by default. The setting
+ * is only applied when the workspace is opened the next time.
+ */
+class WSI_LibrarySnapshot final : public WSI_Base
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        WSI_LibrarySnapshot() = delete;
+        WSI_LibrarySnapshot(const WSI_LibrarySnapshot& other) = delete;
+        explicit WSI_LibrarySnapshot(const SExpression& node);
+        ~WSI_LibrarySnapshot() noexcept;
+
+        // Getters
+        bool getEnabled() const noexcept {return mEnabled;}
+
+        // Getters: Widgets
+        QString getLabelText() const noexcept {return tr("Library Snapshot:");}
+        QWidget* getWidget() const noexcept {return mCheckBox.data();}
+
+        // General Methods
+        void restoreDefault() noexcept override;
+        void apply() noexcept override;
+        void revert() noexcept override;
+
+        /// @copydoc librepcb::SerializableObject::serialize()
+        void serialize(SExpression& root) const override;
+
+        // Operator Overloadings
+        WSI_LibrarySnapshot& operator=(const WSI_LibrarySnapshot& rhs) = delete;
+
+
+    private: // Data
+
+        /**
+         * @brief Whether the library snapshot is enabled or not
+         *
+         * Default: false
+         */
+        bool mEnabled;
+
+        // Widgets
+        QScopedPointer<QCheckBox> mCheckBox;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WSI_LIBRARYSNAPSHOT_H
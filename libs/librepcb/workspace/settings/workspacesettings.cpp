@@ -59,6 +59,8 @@ WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
     loadSettingsItem(mAppearance,               root);
     loadSettingsItem(mLibraryLocaleOrder,       root);
     loadSettingsItem(mLibraryNormOrder,         root);
+    loadSettingsItem(mLibraryFileWatcher,       root);
+    loadSettingsItem(mLibrarySnapshot,          root);
     loadSettingsItem(mRepositories,             root);
     loadSettingsItem(mDebugTools,               root);
 
@@ -33,6 +33,8 @@
 #include "items/wsi_projectautosaveinterval.h"
 #include "items/wsi_librarylocaleorder.h"
 #include "items/wsi_librarynormorder.h"
+#include "items/wsi_libraryfilewatcher.h"
+#include "items/wsi_librarysnapshot.h"
 #include "items/wsi_debugtools.h"
 #include "items/wsi_appearance.h"
 #include "items/wsi_repositories.h"
@@ -84,6 +86,8 @@ class WorkspaceSettings final : public QObject, public SerializableObject
         WSI_Appearance& getAppearance() const noexcept {return *mAppearance;}
         WSI_LibraryLocaleOrder& getLibLocaleOrder() const noexcept {return *mLibraryLocaleOrder;}
         WSI_LibraryNormOrder& getLibNormOrder() const noexcept {return *mLibraryNormOrder;}
+        WSI_LibraryFileWatcher& getLibFileWatcher() const noexcept {return *mLibraryFileWatcher;}
+        WSI_LibrarySnapshot& getLibSnapshot() const noexcept {return *mLibrarySnapshot;}
         WSI_Repositories& getRepositories() const noexcept {return *mRepositories;}
         WSI_DebugTools& getDebugTools() const noexcept {return *mDebugTools;}
 
@@ -131,6 +135,8 @@ class WorkspaceSettings final : public QObject, public SerializableObject
         QScopedPointer<WSI_Appearance> mAppearance;
         QScopedPointer<WSI_LibraryLocaleOrder> mLibraryLocaleOrder;
         QScopedPointer<WSI_LibraryNormOrder> mLibraryNormOrder;
+        QScopedPointer<WSI_LibraryFileWatcher> mLibraryFileWatcher;
+        QScopedPointer<WSI_LibrarySnapshot> mLibrarySnapshot;
         QScopedPointer<WSI_Repositories> mRepositories;
         QScopedPointer<WSI_DebugTools> mDebugTools;
 };
@@ -61,6 +61,10 @@ WorkspaceSettingsDialog::WorkspaceSettingsDialog(WorkspaceSettings& settings) :
                                mSettings.getLibLocaleOrder().getWidget());
     mUi->libraryLayout->addRow(mSettings.getLibNormOrder().getLabelText(),
                                mSettings.getLibNormOrder().getWidget());
+    mUi->libraryLayout->addRow(mSettings.getLibFileWatcher().getLabelText(),
+                               mSettings.getLibFileWatcher().getWidget());
+    mUi->libraryLayout->addRow(mSettings.getLibSnapshot().getLabelText(),
+                               mSettings.getLibSnapshot().getWidget());
 
     // tab: repositories
     mUi->repositoriesLayout->addWidget(mSettings.getRepositories().getWidget());
@@ -95,6 +99,8 @@ WorkspaceSettingsDialog::~WorkspaceSettingsDialog()
     // tab: library
     mSettings.getLibLocaleOrder().getWidget()->setParent(0);
     mSettings.getLibNormOrder().getWidget()->setParent(0);
+    mSettings.getLibFileWatcher().getWidget()->setParent(0);
+    mSettings.getLibSnapshot().getWidget()->setParent(0);
 
     // tab: repositories
     mSettings.getRepositories().getWidget()->setParent(0);
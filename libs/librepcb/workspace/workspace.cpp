@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <QFileDialog>
 #include "workspace.h"
 #include <librepcb/common/exceptions.h>
@@ -36,6 +37,7 @@
 #include "favoriteprojectsmodel.h"
 #include "settings/workspacesettings.h"
 #include <librepcb/library/library.h>
+#include <librepcb/library/librarysnapshot.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -104,6 +106,17 @@ Workspace::Workspace(const FilePath& wsPath) :
     // load workspace settings
     mWorkspaceSettings.reset(new WorkspaceSettings(*this));
 
+    // load the library snapshot (if enabled), used to speed up loading library elements
+    if (mWorkspaceSettings->getLibSnapshot().getEnabled()) {
+        mLibrarySnapshot.reset(new LibrarySnapshot(mLibrariesPath.getPathTo("snapshot.bin"),
+                                                   mLibrariesPath));
+        LibrarySnapshot::setGlobalInstance(mLibrarySnapshot.data());
+        mLibrarySnapshotSaveTimer.setInterval(60000);
+        connect(&mLibrarySnapshotSaveTimer, &QTimer::timeout,
+                this, &Workspace::saveLibrarySnapshotAsync);
+        mLibrarySnapshotSaveTimer.start();
+    }
+
     // load local libraries
     FilePath localLibsDirPath = mLibrariesPath.getPathTo("local");
     QDir localLibsDir(localLibsDirPath.toStr());
@@ -150,6 +163,9 @@ Workspace::Workspace(const FilePath& wsPath) :
             mLibraryDb.data(), &WorkspaceLibraryDb::startLibraryRescan);
     connect(this, &Workspace::libraryRemoved,
             mLibraryDb.data(), &WorkspaceLibraryDb::startLibraryRescan);
+    mLibraryDb->setFileSystemWatcherEnabled(mWorkspaceSettings->getLibFileWatcher().getEnabled());
+    connect(&mWorkspaceSettings->getLibFileWatcher(), &WSI_LibraryFileWatcher::enabledChanged,
+            mLibraryDb.data(), &WorkspaceLibraryDb::setFileSystemWatcherEnabled);
 
     // load project models
     mRecentProjectsModel.reset(new RecentProjectsModel(*this));
@@ -159,6 +175,13 @@ Workspace::Workspace(const FilePath& wsPath) :
 
 Workspace::~Workspace() noexcept
 {
+    // The library snapshot is saved periodically in the background, so modifications of
+    // the last minute are just lost (it's only a cache) instead of blocking the
+    // application on exit. But a running save must be finished before the snapshot is
+    // destroyed.
+    mLibrarySnapshotSaveTimer.stop();
+    LibrarySnapshot::setGlobalInstance(nullptr);
+    mLibrarySnapshotSaveFuture.waitForFinished();
 }
 
 /*****************************************************************************************
@@ -354,6 +377,27 @@ FilePath Workspace::chooseWorkspacePath() noexcept
     return path;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void Workspace::saveLibrarySnapshotAsync() noexcept
+{
+    if ((!mLibrarySnapshot) || (!mLibrarySnapshot->isModified()) ||
+        mLibrarySnapshotSaveFuture.isRunning()) {
+        return;
+    }
+
+    LibrarySnapshot* snapshot = mLibrarySnapshot.data();
+    mLibrarySnapshotSaveFuture = QtConcurrent::run([snapshot](){
+        try {
+            snapshot->save(); // can throw
+        } catch (const Exception& e) {
+            qWarning() << "Failed to save the library snapshot:" << e.getMsg();
+        }
+    });
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -36,6 +36,7 @@ namespace librepcb {
 
 namespace library {
 class Library;
+class LibrarySnapshot;
 }
 
 namespace project{
@@ -303,6 +304,14 @@ class Workspace final : public QObject
         void libraryRemoved(const FilePath& libDir);
 
 
+    private: // Methods
+
+        /**
+         * @brief Save the library snapshot in a background thread (if it was modified)
+         */
+        void saveLibrarySnapshotAsync() noexcept;
+
+
     private: // Data
 
         FilePath mPath; ///< a FilePath object which represents the workspace directory
@@ -311,6 +320,9 @@ class Workspace final : public QObject
         FilePath mLibrariesPath; ///< the directory "v#/libraries"
         DirectoryLock mLock; ///< to lock the version directory (#mVersionPath)
         QScopedPointer<WorkspaceSettings> mWorkspaceSettings; ///< the WorkspaceSettings object
+        QScopedPointer<library::LibrarySnapshot> mLibrarySnapshot; ///< binary cache of library files (optional)
+        QTimer mLibrarySnapshotSaveTimer; ///< to save the library snapshot periodically
+        QFuture<void> mLibrarySnapshotSaveFuture; ///< the running save of the library snapshot
         QMap<QString, QSharedPointer<library::Library>> mLocalLibraries; ///< all local libraries
         QMap<QString, QSharedPointer<library::Library>> mRemoteLibraries; ///< all remote libraries
         QScopedPointer<WorkspaceLibraryDb> mLibraryDb; ///< the library database
@@ -24,6 +24,7 @@ SOURCES += \
     library/cat/categorytreemodel.cpp \
     library/workspacelibrarydb.cpp \
     library/workspacelibraryscanner.cpp \
+    library/workspacelibrarywatcher.cpp \
     projecttreemodel.cpp \
     recentprojectsmodel.cpp \
     settings/items/wsi_appdefaultmeasurementunits.cpp \
@@ -31,6 +32,8 @@ SOURCES += \
     settings/items/wsi_applocale.cpp \
     settings/items/wsi_base.cpp \
     settings/items/wsi_debugtools.cpp \
+    settings/items/wsi_libraryfilewatcher.cpp \
+    settings/items/wsi_librarysnapshot.cpp \
     settings/items/wsi_librarylocaleorder.cpp \
     settings/items/wsi_librarynormorder.cpp \
     settings/items/wsi_projectautosaveinterval.cpp \
@@ -46,6 +49,7 @@ HEADERS += \
     library/cat/categorytreemodel.h \
     library/workspacelibrarydb.h \
     library/workspacelibraryscanner.h \
+    library/workspacelibrarywatcher.h \
     projecttreemodel.h \
     recentprojectsmodel.h \
     settings/items/wsi_appdefaultmeasurementunits.h \
@@ -53,6 +57,8 @@ HEADERS += \
     settings/items/wsi_applocale.h \
     settings/items/wsi_base.h \
     settings/items/wsi_debugtools.h \
+    settings/items/wsi_libraryfilewatcher.h \
+    settings/items/wsi_librarysnapshot.h \
     settings/items/wsi_librarylocaleorder.h \
     settings/items/wsi_librarynormorder.h \
     settings/items/wsi_projectautosaveinterval.h \
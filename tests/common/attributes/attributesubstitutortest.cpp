@@ -100,6 +100,41 @@ INSTANTIATE_TEST_CASE_P(AttributeSubstitutorTest, AttributeSubstitutorTest, ::te
 
 // TODO: disabled test cases fail because of bugs in the librepcb::AttributeSubstitutor!
 
+/*****************************************************************************************
+ *  Other Test Methods
+ ****************************************************************************************/
+
+TEST(AttributeSubstitutorUsedAttributesTest, testUsedAttributes)
+{
+    AttributeProviderDummy ap;
+    QHash<QString, QString> used;
+    AttributeSubstitutor::substitute("{{FOO or KEY_4}} {{'literal'}}", &ap, nullptr, &used);
+    QHash<QString, QString> expected = {
+        {"FOO",   ""},
+        {"KEY_4", "Recursive {{KEY_1}} value"},
+        {"KEY_1", "Normal value"},
+    };
+    EXPECT_EQ(expected, used);
+}
+
+TEST(AttributeSubstitutorBenchmark, testSubstituteManyTexts)
+{
+    // typical texts of a board with many devices (a few distinct templates)
+    const QStringList texts = {"{{NAME}}", "{{VALUE}}", "{{KEY_1}}", "{{KEY_5}}",
+                               "Rev {{FOO or 'n/a'}}", "plain text without variables"};
+    const int iterations = 100000;
+
+    AttributeProviderDummy ap;
+    QElapsedTimer timer;
+    timer.start();
+    int totalLength = 0;
+    for (int i = 0; i < iterations; ++i) {
+        totalLength += AttributeSubstitutor::substitute(texts.at(i % texts.count()), &ap).length();
+    }
+    RecordProperty("SubstituteTimeMs", static_cast<int>(timer.elapsed()));
+    EXPECT_GT(totalLength, 0);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/excellongenerator.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class ExcellonGeneratorTest : public ::testing::Test
+{
+    protected:
+        static QStringList getDrillLines(const QString& output) noexcept {
+            QStringList lines;
+            foreach (const QString& line, output.split('\n')) {
+                if (line.startsWith('X') || line.startsWith('T')) lines.append(line);
+            }
+            return lines;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ExcellonGeneratorTest, testToolList)
+{
+    ExcellonGenerator gen;
+    gen.drill(Point(1000000, 2000000), Length(800000));
+    gen.drill(Point(3000000, 4000000), Length(300000));
+    gen.drill(Point(5000000, 6000000), Length(800000));
+    gen.generate();
+    QStringList expected = {"T1C0.3", "T2C0.8", "T1", "X3.0Y4.0", "T2", "X1.0Y2.0",
+                            "X5.0Y6.0", "T0"};
+    EXPECT_EQ(expected, getDrillLines(gen.toStr()));
+    // 5mm + sqrt(8)mm + sqrt(32)mm
+    EXPECT_NEAR(13485281, gen.getTravelLength(false).toNm(), 1);
+    EXPECT_EQ(gen.getTravelLength(false), gen.getTravelLength(true));
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizeDrillOrder)
+{
+    // drills on a 25x40 grid, added in a scrambled order which requires a lot of travel
+    QSet<QString> drills;
+    ExcellonGenerator gen;
+    for (int i = 0; i < 1000; ++i) {
+        int index = (i * 373) % 1000; // 373 is coprime to 1000 -> permutation
+        int x = index % 25;
+        int y = index / 25;
+        Point pos(Length(x * 1000000), Length(y * 1000000));
+        gen.drill(pos, Length(300000));
+        drills.insert(QString("X%1Y%2").arg(pos.getX().toMmString(), pos.getY().toMmString()));
+    }
+    gen.setOptimizeDrillOrder(true);
+    gen.generate();
+
+    // every drill must still be contained exactly once
+    QStringList lines = getDrillLines(gen.toStr()).filter(QRegularExpression("^X"));
+    EXPECT_EQ(drills.count(), lines.count());
+    EXPECT_EQ(drills, lines.toSet());
+
+    // the travel length must be reduced significantly
+    EXPECT_LT(gen.getTravelLength(true) * 2, gen.getTravelLength(false));
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizeDrillOrderIsDeterministic)
+{
+    ExcellonGenerator gen1, gen2, gen3;
+    for (int i = 0; i < 500; ++i) {
+        Point pos(Length(((i * 7919) % 997) * 100000), Length(((i * 104729) % 991) * 100000));
+        gen1.drill(pos, Length(300000));
+        gen2.drill(pos, Length(300000));
+        gen3.drill(pos, Length(300000));
+    }
+    gen1.setOptimizeDrillOrder(true, 4);
+    gen2.setOptimizeDrillOrder(true, 4);
+    gen3.setOptimizeDrillOrder(true, 0); // Hilbert curve only
+    gen1.generate();
+    gen2.generate();
+    gen3.generate();
+
+    // the result depends only on the number of passes, not on the machine speed
+    EXPECT_EQ(getDrillLines(gen1.toStr()), getDrillLines(gen2.toStr()));
+    EXPECT_LE(gen1.getTravelLength(true), gen3.getTravelLength(true));
+    EXPECT_LT(gen3.getTravelLength(true), gen3.getTravelLength(false));
+}
+
+TEST_F(ExcellonGeneratorTest, testStepAndRepeat)
+{
+    ExcellonGenerator gen;
+    gen.drill(Point(1000000, 2000000), Length(800000));
+    gen.setStepAndRepeat(3, 2, Point(10000000, 20000000));
+    gen.generate();
+    QStringList lines = gen.toStr().split('\n').filter(
+        QRegularExpression("^(T|X|M25|M01|M02|M08)"));
+    QStringList expected = {"T1C0.8", "T1", "M25", "X1.0Y2.0", "M01", "M02X10.0Y0.0",
+                            "M02X20.0Y0.0", "M02X20.0Y20.0", "M02X10.0Y20.0",
+                            "M02X0.0Y20.0", "M08", "T0"};
+    EXPECT_EQ(expected, lines);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,84 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerberaperturelist.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class GerberApertureListTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(GerberApertureListTest, testApertureNumbersAreReused)
+{
+    GerberApertureList list;
+    EXPECT_EQ(10, list.setCircle(Length(100000), Length(0)));
+    EXPECT_EQ(11, list.setRect(Length(100000), Length(200000), Angle(0), Length(0)));
+    EXPECT_EQ(12, list.setObround(Length(100000), Length(200000), Angle::deg45(), Length(0)));
+    EXPECT_EQ(10, list.setCircle(Length(100000), Length(0)));
+    EXPECT_EQ(11, list.setRect(Length(100000), Length(200000), Angle::deg180(), Length(0)));
+    EXPECT_EQ(11, list.setRect(Length(200000), Length(100000), Angle::deg90(), Length(0)));
+    EXPECT_EQ(12, list.setObround(Length(100000), Length(200000), Angle::deg45(), Length(0)));
+    EXPECT_EQ(13, list.setCircle(Length(100000), Length(50000)));
+}
+
+TEST(GerberApertureListTest, testGenerateString)
+{
+    GerberApertureList list;
+    list.setCircle(Length(100000), Length(0));
+    list.setRect(Length(100000), Length(200000), Angle::deg90(), Length(50000));
+    list.setCircle(Length(100000), Length(0));
+    QString expected =
+        "G04 --- APERTURE LIST BEGIN --- *\n"
+        "%ADD10C,0.1*%\n"
+        "%ADD11R,0.2X0.1X0.05*%\n"
+        "G04 --- APERTURE LIST END --- *\n";
+    EXPECT_EQ(expected.toStdString(), list.generateString().toStdString());
+}
+
+TEST(GerberApertureListTest, testReset)
+{
+    GerberApertureList list;
+    list.setCircle(Length(100000), Length(0));
+    list.setCircle(Length(200000), Length(0));
+    list.reset();
+    EXPECT_EQ(10, list.setCircle(Length(200000), Length(0)));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,87 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerbergenerator.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class GerberGeneratorTest : public ::testing::Test
+{
+    protected:
+        static QStringList getLines(const QString& output, const QString& regex) noexcept {
+            return output.split('\n').filter(QRegularExpression(regex));
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GerberGeneratorTest, testSingleBoard)
+{
+    GerberGenerator gen("test", Uuid::createRandom(), "v1");
+    gen.drawLine(Point(0, 0), Point(1000000, 0), Length(200000));
+    gen.generate();
+    EXPECT_EQ(QStringList{"%TF.Part,Single*%"}, getLines(gen.toStr(), "^%TF\\.Part"));
+    EXPECT_EQ(QStringList(), getLines(gen.toStr(), "^%SR"));
+}
+
+TEST_F(GerberGeneratorTest, testStepAndRepeat)
+{
+    GerberGenerator gen("test", Uuid::createRandom(), "v1");
+    gen.setStepAndRepeat(3, 2, Point(10000000, 20000000));
+    gen.drawLine(Point(0, 0), Point(1000000, 0), Length(200000));
+    gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
+    gen.drawLine(Point(0, 0), Point(0, 1000000), Length(200000));
+    gen.generate();
+    QString output = gen.toStr();
+
+    EXPECT_EQ(QStringList{"%TF.Part,Array*%"}, getLines(output, "^%TF\\.Part"));
+    QStringList expected = {"%SRX3Y2I10.0J20.0*%", "%SR*%"};
+    EXPECT_EQ(expected, getLines(output, "^%SR"));
+
+    // the content is written only once, inside the step and repeat block which must
+    // start with dark polarity (the content ends with clear polarity)
+    int srBegin = output.indexOf("%SRX");
+    int srEnd = output.indexOf("%SR*%");
+    EXPECT_TRUE(output.mid(srBegin).section('\n', 1, 1) == "%LPD*%");
+    EXPECT_EQ(1, output.count("--- BOARD BEGIN ---"));
+    EXPECT_GT(output.indexOf("--- BOARD BEGIN ---"), srBegin);
+    EXPECT_LT(output.indexOf("--- BOARD END ---"), srEnd);
+    EXPECT_LT(srEnd, output.indexOf("M02*"));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexpression.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SExpressionTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(SExpressionTest, testParseTopLevelLists)
+{
+    QString str = "(librepcb_symbol 2b3e6d1a-4a3d-4b34-8a30-7d1b6d3ab4f9\n"
+                  " (name \"Foo (bar)\")\n"
+                  " (polygon (layer sym_outlines) (vertex (pos 0.0 0.0) (angle 0.0)))\n"
+                  " (text \"escaped \\\" ) quote\" (pos 1.0 2.0))\n"
+                  " (version 0.1)\n"
+                  ")\n";
+    SExpression root = SExpression::parseTopLevelLists(str, FilePath(), {"name", "version"});
+    EXPECT_EQ("librepcb_symbol", root.getName());
+    EXPECT_EQ(3, root.getChildren().count());
+    EXPECT_EQ("2b3e6d1a-4a3d-4b34-8a30-7d1b6d3ab4f9",
+              root.getChildByIndex(0).getValue<QString>(true));
+    EXPECT_EQ("Foo (bar)", root.getValueByPath<QString>("name", true));
+    EXPECT_EQ("0.1", root.getValueByPath<QString>("version", true));
+    EXPECT_EQ(nullptr, root.tryGetChildByPath("polygon"));
+    EXPECT_EQ(nullptr, root.tryGetChildByPath("text"));
+}
+
+TEST(SExpressionTest, testParseTopLevelListsInvalid)
+{
+    EXPECT_THROW(SExpression::parseTopLevelLists("(foo (bar)", FilePath(), {"bar"}),
+                 Exception);
+    EXPECT_THROW(SExpression::parseTopLevelLists("", FilePath(), {"bar"}), Exception);
+}
+
+TEST(SExpressionTest, testBinarySerialization)
+{
+    QString str = "(root \"string \\\" value\" (list token (nested 1.5 \"\"))\n (empty))";
+    SExpression root = SExpression::parse(str, FilePath());
+    QByteArray data;
+    QDataStream outStream(&data, QIODevice::WriteOnly);
+    root.serializeToBinary(outStream);
+    QDataStream inStream(data);
+    SExpression copy = SExpression::deserializeFromBinary(inStream, FilePath());
+    EXPECT_EQ(root.toString(0), copy.toString(0));
+}
+
+TEST(SExpressionTest, testBinaryDeserializationInvalid)
+{
+    QByteArray data("\xFF\x00\x00", 3);
+    QDataStream stream(data);
+    EXPECT_THROW(SExpression::deserializeFromBinary(stream, FilePath()), Exception);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
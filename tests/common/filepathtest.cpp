@@ -22,6 +22,7 @@
  ****************************************************************************************/
 
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/filepath.h>
 
@@ -165,6 +166,26 @@ TEST(FilePathTest, testCleanFileName)
     EXPECT_EQ(".AEG14X_RTSTXN_0H2-121OA23__", rsuc) << qPrintable(rsuc);
 }
 
+TEST(FilePathTest, testGetRandomTempPathIsUniqueAcrossThreads)
+{
+    // qrand() is seeded per thread, so all threads generate the same random numbers
+    QList<QFuture<QStringList>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.append(QtConcurrent::run([](){
+            QStringList paths;
+            for (int k = 0; k < 100; ++k) {
+                paths.append(FilePath::getRandomTempPath().toStr());
+            }
+            return paths;
+        }));
+    }
+    QSet<QString> paths;
+    for (QFuture<QStringList>& future : futures) {
+        paths.unite(future.result().toSet());
+    }
+    EXPECT_EQ(800, paths.count());
+}
+
 /*****************************************************************************************
  *  Test Data
  ****************************************************************************************/
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/attributes/attributeprovider.h>
+#include <librepcb/common/geometry/stroketext.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class StrokeTextTest : public ::testing::Test
+{
+    protected:
+
+        class AttributeProviderMock final : public AttributeProvider
+        {
+            public:
+                QHash<QString, QString> values;
+                QString getUserDefinedAttributeValue(const QString& key) const noexcept override {
+                    return values.value(key);
+                }
+                void attributesChanged() override {}
+        };
+
+        static StrokeText createText(const QString& text) noexcept {
+            return StrokeText(Uuid::createRandom(), GraphicsLayer::sTopPlacement, text,
+                              Point(), Angle(), Length(1000000), Length(200000),
+                              StrokeTextSpacing(), StrokeTextSpacing(), Alignment(),
+                              false, false);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(StrokeTextTest, testUpdatePathsIfAttributesChanged)
+{
+    AttributeProviderMock ap;
+    ap.values = {{"NAME", "R1"}, {"VALUE", "10k"}};
+    StrokeText text = createText("{{NAME}}");
+    text.setAttributeProvider(&ap);
+    text.setFont(&qApp->getDefaultStrokeFont());
+
+    // nothing has changed since the last update
+    EXPECT_FALSE(text.updatePathsIfAttributesChanged());
+
+    // an attribute which is not used in the text has changed
+    ap.values.insert("VALUE", "4k7");
+    EXPECT_FALSE(text.updatePathsIfAttributesChanged());
+
+    // the used attribute has changed, but only the first call has to update the paths
+    ap.values.insert("NAME", "R2");
+    EXPECT_TRUE(text.updatePathsIfAttributesChanged());
+    EXPECT_FALSE(text.updatePathsIfAttributesChanged());
+
+    // the used attribute was removed
+    ap.values.remove("NAME");
+    EXPECT_TRUE(text.updatePathsIfAttributesChanged());
+}
+
+TEST_F(StrokeTextTest, testUpdatePathsIfAttributesChangedWithoutFont)
+{
+    AttributeProviderMock ap;
+    ap.values = {{"NAME", "R1"}};
+    StrokeText text = createText("{{NAME}}");
+    text.setAttributeProvider(&ap);
+    ap.values.insert("NAME", "R2");
+    EXPECT_FALSE(text.updatePathsIfAttributesChanged());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
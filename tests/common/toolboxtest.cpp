@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtGui>
 #include <gtest/gtest.h>
 #include <librepcb/common/toolbox.h>
 
@@ -66,6 +67,95 @@ TEST(ToolboxTest, testStringOrNumberToQVariant_mixed)
     EXPECT_EQ(QVariant("l33t"), variant);
 }
 
+TEST(ToolboxTest, testFindConnectedNodes_disconnected)
+{
+    // 0 -- 1 -- 2    3 -- 4
+    QVector<QVector<int>> adjacency = {{1}, {0, 2}, {1}, {4}, {3}};
+    EXPECT_EQ(QVector<int>({0, 1, 2}), Toolbox::findConnectedNodes(adjacency, 0));
+    EXPECT_EQ(QVector<int>({4, 3}), Toolbox::findConnectedNodes(adjacency, 4));
+}
+
+TEST(ToolboxTest, testFindConnectedNodes_invalidStart)
+{
+    QVector<QVector<int>> adjacency = {{}};
+    EXPECT_EQ(QVector<int>(), Toolbox::findConnectedNodes(adjacency, 1));
+    EXPECT_EQ(QVector<int>(), Toolbox::findConnectedNodes(adjacency, -1));
+}
+
+TEST(ToolboxTest, testFindConnectedNodes_longChain)
+{
+    // a very long chain must not lead to a stack overflow
+    const int count = 1000000;
+    QVector<QVector<int>> adjacency(count);
+    for (int i = 1; i < count; ++i) {
+        adjacency[i - 1].append(i);
+        adjacency[i].append(i - 1);
+    }
+    EXPECT_EQ(count, Toolbox::findConnectedNodes(adjacency, count / 2).count());
+}
+
+TEST(ToolboxTest, testSimplifiedPath_collinearVerticesAreRemoved)
+{
+    QPainterPath path;
+    path.moveTo(0, 0);
+    path.lineTo(1, 0);
+    path.lineTo(2, 0.01); // deviation below the tolerance
+    path.lineTo(3, 0);
+    path.lineTo(3, 3);
+    QList<QPolygonF> polygons = Toolbox::simplifiedPath(path, 0.1).toSubpathPolygons();
+    ASSERT_EQ(1, polygons.count());
+    EXPECT_EQ(QPolygonF({QPointF(0, 0), QPointF(3, 0), QPointF(3, 3)}), polygons.first());
+}
+
+TEST(ToolboxTest, testSimplifiedPath_deviationIsBelowTolerance)
+{
+    // circle with 1000 vertices and a radius of 100
+    QPolygonF circle;
+    for (int i = 0; i <= 1000; ++i) {
+        qreal angle = 2 * M_PI * i / 1000;
+        circle.append(QPointF(100 * qCos(angle), 100 * qSin(angle)));
+    }
+    QPainterPath path;
+    path.addPolygon(circle);
+    const qreal tolerance = 0.5;
+    QList<QPolygonF> polygons = Toolbox::simplifiedPath(path, tolerance).toSubpathPolygons();
+    ASSERT_EQ(1, polygons.count());
+    const QPolygonF& simplified = polygons.first();
+    EXPECT_LT(simplified.count(), circle.count() / 4);
+
+    // every original vertex must be within the tolerance of the simplified polygon
+    foreach (const QPointF& p, circle) {
+        qreal minDistance = std::numeric_limits<qreal>::max();
+        for (int i = 1; i < simplified.count(); ++i) {
+            QLineF segment(simplified.at(i - 1), simplified.at(i));
+            QPointF dir = segment.p2() - segment.p1();
+            qreal t = QPointF::dotProduct(p - segment.p1(), dir) /
+                      QPointF::dotProduct(dir, dir);
+            QPointF nearest = segment.p1() + dir * qBound(qreal(0), t, qreal(1));
+            minDistance = qMin(minDistance, QLineF(p, nearest).length());
+        }
+        EXPECT_LT(minDistance, tolerance) << p.x() << "/" << p.y();
+    }
+}
+
+TEST(ToolboxTest, testSimplifiedPath_closedPathsStayClosed)
+{
+    // square with additional vertices on its edges and a tiny second subpath
+    QPainterPath path;
+    path.setFillRule(Qt::WindingFill);
+    path.addPolygon(QPolygonF({QPointF(0, 0), QPointF(5, 0), QPointF(10, 0),
+                               QPointF(10, 5), QPointF(10, 10), QPointF(5, 10),
+                               QPointF(0, 10), QPointF(0, 5), QPointF(0, 0)}));
+    path.addRect(20, 20, 0.05, 0.05); // smaller than the tolerance
+    QPainterPath simplified = Toolbox::simplifiedPath(path, 0.1);
+    EXPECT_EQ(Qt::WindingFill, simplified.fillRule());
+    QList<QPolygonF> polygons = simplified.toSubpathPolygons();
+    ASSERT_EQ(1, polygons.count());
+    EXPECT_EQ(QPolygonF({QPointF(0, 0), QPointF(10, 0), QPointF(10, 10), QPointF(0, 10),
+                         QPointF(0, 0)}), polygons.first());
+    EXPECT_TRUE(polygons.first().isClosed());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -0,0 +1,179 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class ClipperHelpersTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(ClipperHelpersTest, testConvertArcsEqualsFlatArc)
+{
+    Point p1(1000000, 500000);
+    Point p2(-300000, 2500000);
+    Angle angle(135000000);
+    Length tolerance(5000);
+
+    Path path;
+    path.addVertex(p1, angle);
+    path.addVertex(p2);
+    ClipperLib::Path actual = ClipperHelpers::convert(path, tolerance);
+
+    ClipperLib::Path expected;
+    foreach (const Vertex& vertex, Path::flatArc(p1, p2, angle, tolerance).getVertices()) {
+        expected.push_back(ClipperHelpers::convert(vertex.getPos()));
+    }
+    if (!ClipperLib::Orientation(expected)) {
+        ClipperLib::ReversePath(expected);
+    }
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(ClipperHelpersTest, testConvertCircle)
+{
+    // the diameter is not used in any other test, so the circles are not cached yet
+    Length diameter(600007);
+    QList<Point> centers = {Point(0, 0), Point(100, -200), Point(1234567, 7654321),
+                            Point(-3333333, 5)};
+    foreach (const Point& center, centers) {
+        ClipperLib::Path expected = ClipperHelpers::convert(
+            Path::circle(diameter).translated(center), Length(5000));
+        ClipperHelpers::resetStatistics();
+        ClipperLib::Path actual = ClipperHelpers::convertCircle(center, diameter,
+                                                                Length(5000));
+        ClipperLib::Path cached = ClipperHelpers::convertCircle(center, diameter,
+                                                                Length(5000));
+        EXPECT_EQ(expected, actual) << center.getX().toNm() << "/" << center.getY().toNm();
+        EXPECT_EQ(expected, cached) << center.getX().toNm() << "/" << center.getY().toNm();
+        ClipperHelpers::Statistics stats = ClipperHelpers::getStatistics();
+        EXPECT_EQ(1, stats.circleCacheMisses);
+        EXPECT_EQ(1, stats.circleCacheHits);
+        EXPECT_EQ(qint64(expected.size()), stats.convertedVertices);
+    }
+    EXPECT_NE(ClipperHelpers::convertCircle(Point(0, 0), diameter, Length(5000)),
+              ClipperHelpers::convertCircle(Point(0, 0), diameter, Length(50000)));
+    EXPECT_TRUE(ClipperHelpers::convertCircle(Point(0, 0), Length(0), Length(5000)).empty());
+}
+
+TEST(ClipperHelpersTest, testFlatArcSteps)
+{
+    Point p1(1000000, 0);
+    Point p2(0, 1000000);
+    Angle angle(90000000);
+    EXPECT_EQ(1, Path::flatArcSteps(p1, p2, angle, Length(10000000))); // radius too small
+    int steps = Path::flatArcSteps(p1, p2, angle, Length(5000));
+    EXPECT_GT(steps, 1);
+    EXPECT_EQ(steps + 1, Path::flatArc(p1, p2, angle, Length(5000)).getVertices().count());
+    EXPECT_LT(steps, Path::flatArcSteps(p1, p2, angle, Length(500)));
+}
+
+TEST(ClipperHelpersTest, testRemoveNonIntersectingBoundsOverlapButShapesDont)
+{
+    // triangle in the lower left corner of the rect (0,0)-(1000,1000)
+    ClipperLib::Paths areas = {{{0, 0}, {1000, 0}, {0, 1000}}};
+    // inside the triangle's bounding rect, but not touching the triangle
+    ClipperLib::Path outside = {{700, 700}, {900, 700}, {900, 900}, {700, 900}};
+    // inside the triangle
+    ClipperLib::Path inside = {{100, 100}, {200, 100}, {200, 200}, {100, 200}};
+    ClipperLib::Paths paths = {outside, inside};
+    ClipperLib::Clipper c;
+    ClipperHelpers::removeNonIntersecting(c, paths, areas);
+    EXPECT_EQ(ClipperLib::Paths({inside}), paths);
+}
+
+TEST(ClipperHelpersTest, testRemoveNonIntersectingShapesOverlapButFirstBoundsDont)
+{
+    ClipperLib::Paths areas = {
+        {{2000, 0}, {3000, 0}, {3000, 1000}, {2000, 1000}},       // overlaps
+        {{-5000, 5000}, {5000, 5000}, {5000, 6000}, {-5000, 6000}}, // left, but above
+        {},                                                         // empty area
+        {{-1000, -1000}, {-500, -1000}, {-500, -500}, {-1000, -500}}, // left, below
+    };
+    // the only overlapping area is not the first one when sorted by the left edge
+    ClipperLib::Path connected = {{2500, 500}, {3500, 500}, {3500, 1500}, {2500, 1500}};
+    // bounding rect doesn't overlap any area
+    ClipperLib::Path orphan = {{0, 2000}, {1000, 2000}, {1000, 3000}, {0, 3000}};
+    // only touches an area at one edge (no area in common)
+    ClipperLib::Path touching = {{3000, 0}, {4000, 0}, {4000, 1000}, {3000, 1000}};
+    ClipperLib::Paths paths = {orphan, connected, touching};
+    ClipperLib::Clipper c;
+    ClipperHelpers::removeNonIntersecting(c, paths, areas);
+    EXPECT_EQ(ClipperLib::Paths({connected}), paths);
+
+    // without any areas, all paths are removed
+    ClipperHelpers::removeNonIntersecting(c, paths, ClipperLib::Paths());
+    EXPECT_TRUE(paths.empty());
+}
+
+TEST(ClipperHelpersTest, testRemoveNonIntersectingEqualsFullIntersection)
+{
+    // compare with intersecting every path with all areas (without any index)
+    ClipperLib::Paths areas;
+    ClipperLib::Paths paths;
+    for (int i = 0; i < 10; ++i) {
+        for (int k = 0; k < 10; ++k) {
+            ClipperLib::cInt x = i * 1000 + (k * 37 % 11) * 100;
+            ClipperLib::cInt y = k * 1000 + (i * 53 % 13) * 100;
+            ClipperLib::Path p = {{x, y}, {x + 600, y}, {x, y + 600}};
+            ((i + k) % 3 == 0 ? areas : paths).push_back(p);
+        }
+    }
+    ClipperLib::Paths expected;
+    for (const ClipperLib::Path& p : paths) {
+        ClipperLib::Clipper c;
+        c.AddPaths(areas, ClipperLib::ptSubject, true);
+        c.AddPath(p, ClipperLib::ptClip, true);
+        ClipperLib::Paths intersections;
+        c.Execute(ClipperLib::ctIntersection, intersections, ClipperLib::pftNonZero,
+                  ClipperLib::pftNonZero);
+        if (!intersections.empty()) {
+            expected.push_back(p);
+        }
+    }
+    ClipperLib::Clipper c;
+    ClipperHelpers::removeNonIntersecting(c, paths, areas);
+    EXPECT_EQ(expected, paths);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
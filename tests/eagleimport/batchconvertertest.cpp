@@ -0,0 +1,171 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/eagleimport/batchconverter.h>
+#include <librepcb/eagleimport/converterdb.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BatchConverterTest : public ::testing::Test
+{
+    protected:
+        FilePath mTmpDir;
+        FilePath mOutputDir;
+        QScopedPointer<ConverterDb> mDb;
+
+        BatchConverterTest() {
+            mTmpDir = FilePath::getRandomTempPath();
+            mOutputDir = mTmpDir.getPathTo("output");
+            mDb.reset(new ConverterDb(mTmpDir.getPathTo("db.ini")));
+        }
+
+        virtual ~BatchConverterTest() {
+            mDb.reset();
+            QDir(mTmpDir.toStr()).removeRecursively();
+        }
+
+        /// Records the signals of a converter (they are emitted from worker threads)
+        struct SignalRecorder {
+            QMutex mutex;
+            QList<int> startedElementCounts;
+            int finishedElements = 0;
+            QList<int> finishedFiles;
+            QStringList errors;
+
+            explicit SignalRecorder(BatchConverter& converter) {
+                QObject::connect(&converter, &BatchConverter::fileStarted,
+                                 [this](int index, int count){
+                    Q_UNUSED(index); QMutexLocker l(&mutex);
+                    startedElementCounts.append(count);}, Qt::DirectConnection);
+                QObject::connect(&converter, &BatchConverter::elementFinished,
+                                 [this](int converted, int read){
+                    Q_UNUSED(converted); Q_UNUSED(read); QMutexLocker l(&mutex);
+                    ++finishedElements;}, Qt::DirectConnection);
+                QObject::connect(&converter, &BatchConverter::fileFinished,
+                                 [this](int index){
+                    QMutexLocker l(&mutex); finishedFiles.append(index);},
+                                 Qt::DirectConnection);
+                QObject::connect(&converter, &BatchConverter::errorOccurred,
+                                 [this](const QString& msg){
+                    QMutexLocker l(&mutex); errors.append(msg);}, Qt::DirectConnection);
+            }
+        };
+
+        FilePath createLibrary(const QString& name, const QStringList& symbolNames) {
+            QString symbols;
+            foreach (const QString& symbolName, symbolNames) {
+                symbols += QString("<symbol name=\"%1\"></symbol>\n").arg(symbolName);
+            }
+            FilePath fp = mTmpDir.getPathTo(name);
+            FileUtils::writeFile(fp, QString(
+                "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+                "<eagle version=\"7.7.0\">\n<drawing>\n<library>\n"
+                "<packages>\n</packages>\n<symbols>\n%1</symbols>\n"
+                "<devicesets>\n</devicesets>\n</library>\n</drawing>\n</eagle>\n")
+                .arg(symbols).toUtf8());
+            return fp;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BatchConverterTest, testConvertSymbols)
+{
+    FilePath lib = createLibrary("test.lbr", {"A", "B", "C", "D", "E"});
+    BatchConverter converter(*mDb, mOutputDir);
+    SignalRecorder recorder(converter);
+    converter.convert(BatchConverter::Type::Symbols, {lib});
+
+    EXPECT_EQ(QStringList(), recorder.errors);
+    EXPECT_EQ(QList<int>{5}, recorder.startedElementCounts);
+    EXPECT_EQ(5, recorder.finishedElements);
+    EXPECT_EQ(QList<int>{0}, recorder.finishedFiles);
+    EXPECT_EQ(5, converter.getReadElementsCount());
+    EXPECT_EQ(5, converter.getConvertedElementsCount());
+
+    // every element must be written into its own directory with the UUID of the db
+    QStringList dirs = QDir(mOutputDir.getPathTo("sym").toStr())
+                       .entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+    EXPECT_EQ(5, dirs.count());
+    mDb->setCurrentLibraryFilePath(lib);
+    EXPECT_TRUE(dirs.contains(mDb->getSymbolUuid("A").toStr()));
+    EXPECT_TRUE(dirs.contains(mDb->getSymbolUuid("E").toStr()));
+}
+
+TEST_F(BatchConverterTest, testConvertIsRepeatable)
+{
+    FilePath lib = createLibrary("test.lbr", {"A", "B"});
+    BatchConverter converter(*mDb, mOutputDir);
+    converter.convert(BatchConverter::Type::Symbols, {lib});
+    converter.convert(BatchConverter::Type::Symbols, {lib});
+    EXPECT_EQ(2, converter.getReadElementsCount()); // counters are reset
+    EXPECT_EQ(2, converter.getConvertedElementsCount());
+    EXPECT_EQ(2, QDir(mOutputDir.getPathTo("sym").toStr())
+                 .entryList(QDir::Dirs | QDir::NoDotAndDotDot).count());
+}
+
+TEST_F(BatchConverterTest, testMissingAndInvalidFiles)
+{
+    FilePath missing = mTmpDir.getPathTo("missing.lbr");
+    FilePath invalid = mTmpDir.getPathTo("invalid.lbr");
+    FileUtils::writeFile(invalid, "garbage");
+    FilePath valid = createLibrary("valid.lbr", {"A"});
+    BatchConverter converter(*mDb, mOutputDir);
+    SignalRecorder recorder(converter);
+    converter.convert(BatchConverter::Type::Symbols, {missing, invalid, valid});
+
+    EXPECT_EQ(2, recorder.errors.count());
+    EXPECT_EQ((QList<int>{0, 1, 2}), recorder.finishedFiles);
+    EXPECT_EQ(1, converter.getConvertedElementsCount());
+}
+
+TEST_F(BatchConverterTest, testConvertWithoutFiles)
+{
+    BatchConverter converter(*mDb, mOutputDir);
+    SignalRecorder recorder(converter);
+    converter.convert(BatchConverter::Type::Packages, {});
+    EXPECT_EQ(QStringList(), recorder.errors);
+    EXPECT_EQ(0, converter.getReadElementsCount());
+    EXPECT_FALSE(mOutputDir.isExistingDir());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include <gtest/gtest.h>
+#include <librepcb/eagleimport/converterdb.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class ConverterDbTest : public ::testing::Test
+{
+    protected:
+        FilePath mTmpDir;
+        FilePath mIniFile;
+
+        ConverterDbTest() {
+            mTmpDir = FilePath::getRandomTempPath();
+            mIniFile = mTmpDir.getPathTo("db.ini");
+        }
+
+        virtual ~ConverterDbTest() {
+            QDir(mTmpDir.toStr()).removeRecursively();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ConverterDbTest, testUuidsAreStable)
+{
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    Uuid uuid = db.getSymbolUuid("R");
+    EXPECT_FALSE(uuid.isNull());
+    EXPECT_EQ(uuid, db.getSymbolUuid("R"));
+    EXPECT_NE(uuid, db.getSymbolUuid("C"));
+    EXPECT_NE(uuid, db.getPackageUuid("R")); // other category
+}
+
+TEST_F(ConverterDbTest, testUuidsDependOnLibrary)
+{
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    Uuid uuid = db.getSymbolUuid("R");
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("bar.lbr"));
+    EXPECT_NE(uuid, db.getSymbolUuid("R"));
+}
+
+TEST_F(ConverterDbTest, testFlush)
+{
+    Uuid uuid;
+    {
+        ConverterDb db(mIniFile);
+        db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+        uuid = db.getDeviceUuid("R 1", "{R-0805}");
+        db.flush();
+        EXPECT_TRUE(mIniFile.isExistingFile());
+    }
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    EXPECT_EQ(uuid, db.getDeviceUuid("R 1", "{R-0805}"));
+}
+
+TEST_F(ConverterDbTest, testDestructorFlushes)
+{
+    Uuid uuid;
+    {
+        ConverterDb db(mIniFile);
+        db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+        uuid = db.getComponentUuid("R");
+    }
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    EXPECT_EQ(uuid, db.getComponentUuid("R"));
+}
+
+TEST_F(ConverterDbTest, testInvalidUuidThrows)
+{
+    {
+        QSettings ini(mIniFile.toStr(), QSettings::IniFormat);
+        ini.setValue("symbols/foo.lbr_R_", "invalid");
+    }
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    EXPECT_THROW(db.getSymbolUuid("R"), RuntimeError);
+}
+
+TEST_F(ConverterDbTest, testConcurrentAccess)
+{
+    ConverterDb db(mIniFile);
+    db.setCurrentLibraryFilePath(mTmpDir.getPathTo("foo.lbr"));
+    QList<QFuture<QList<Uuid>>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.append(QtConcurrent::run([&db](){
+            QList<Uuid> uuids;
+            for (int k = 0; k < 100; ++k) {
+                uuids.append(db.getSymbolUuid(QString::number(k)));
+            }
+            return uuids;
+        }));
+    }
+    // all threads must get the same UUID for the same name
+    QList<Uuid> expected = futures.first().result();
+    EXPECT_EQ(100, expected.toSet().count());
+    for (QFuture<QList<Uuid>>& future : futures) {
+        EXPECT_EQ(expected, future.result());
+    }
+    db.flush();
+    EXPECT_EQ(100, QSettings(mIniFile.toStr(), QSettings::IniFormat).allKeys().count());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
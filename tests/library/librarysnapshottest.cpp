@@ -0,0 +1,193 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/library/librarysnapshot.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LibrarySnapshotTest : public ::testing::Test
+{
+    protected:
+        FilePath mTmpDir;
+        FilePath mRootDir;
+        FilePath mSnapshotFile;
+        FilePath mElementFile;
+
+        LibrarySnapshotTest() {
+            mTmpDir = FilePath::getRandomTempPath();
+            mRootDir = mTmpDir.getPathTo("libraries");
+            mSnapshotFile = mRootDir.getPathTo("snapshot.bin");
+            mElementFile = mRootDir.getPathTo("local/lib/sym/element/symbol.lp");
+            FileUtils::writeFile(mElementFile, "(symbol foo\n (name \"bar 1\")\n)\n");
+        }
+
+        virtual ~LibrarySnapshotTest() {
+            QDir(mTmpDir.toStr()).removeRecursively();
+        }
+
+        static SExpression parse(const FilePath& fp) {
+            return SExpression::parse(FileUtils::readFile(fp), fp);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LibrarySnapshotTest, testHit)
+{
+    LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+    SExpression dom = parse(mElementFile);
+    SExpression loaded;
+    EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded));
+    snapshot.insert(mElementFile, dom);
+    EXPECT_EQ(1, snapshot.getEntriesCount());
+    EXPECT_TRUE(snapshot.isModified());
+    ASSERT_TRUE(snapshot.tryLoad(mElementFile, loaded));
+    EXPECT_EQ(dom.toString(0), loaded.toString(0));
+    EXPECT_EQ(mElementFile, loaded.getFilePath());
+}
+
+TEST_F(LibrarySnapshotTest, testFilesOutsideRootDirAreIgnored)
+{
+    FilePath fp = mTmpDir.getPathTo("project/library/sym/element/symbol.lp");
+    FileUtils::writeFile(fp, "(symbol foo)\n");
+    LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+    snapshot.insert(fp, parse(fp));
+    SExpression loaded;
+    EXPECT_EQ(0, snapshot.getEntriesCount());
+    EXPECT_FALSE(snapshot.isModified());
+    EXPECT_FALSE(snapshot.tryLoad(fp, loaded));
+}
+
+TEST_F(LibrarySnapshotTest, testInvalidationOnFileChange)
+{
+    LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+    snapshot.insert(mElementFile, parse(mElementFile));
+
+    // same size and (probably) same modification time, only the content differs
+    FileUtils::writeFile(mElementFile, "(symbol foo\n (name \"bar 2\")\n)\n");
+    SExpression loaded;
+    EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded));
+
+    // the updated entry is used again
+    SExpression dom = parse(mElementFile);
+    snapshot.insert(mElementFile, dom);
+    ASSERT_TRUE(snapshot.tryLoad(mElementFile, loaded));
+    EXPECT_EQ(dom.toString(0), loaded.toString(0));
+
+    // removed files are not loaded
+    FileUtils::removeFile(mElementFile);
+    EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded));
+}
+
+TEST_F(LibrarySnapshotTest, testSaveAndReload)
+{
+    SExpression dom = parse(mElementFile);
+    FilePath removedFile = mRootDir.getPathTo("local/lib/sym/removed/symbol.lp");
+    FileUtils::writeFile(removedFile, "(symbol removed)\n");
+    {
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        snapshot.insert(mElementFile, dom);
+        snapshot.insert(removedFile, parse(removedFile));
+        FileUtils::removeFile(removedFile);
+        EXPECT_NO_THROW(snapshot.save());
+        EXPECT_FALSE(snapshot.isModified());
+        EXPECT_EQ(1, snapshot.getEntriesCount()); // removed file dropped
+    }
+    EXPECT_TRUE(mSnapshotFile.isExistingFile());
+
+    LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+    EXPECT_EQ(1, snapshot.getEntriesCount());
+    EXPECT_FALSE(snapshot.isModified());
+    SExpression loaded;
+    ASSERT_TRUE(snapshot.tryLoad(mElementFile, loaded));
+    EXPECT_EQ(dom.toString(0), loaded.toString(0));
+}
+
+TEST_F(LibrarySnapshotTest, testTruncatedFile)
+{
+    {
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        snapshot.insert(mElementFile, parse(mElementFile));
+        snapshot.save();
+    }
+    QByteArray content = FileUtils::readFile(mSnapshotFile);
+    for (int length : {content.length() - 1, content.length() / 2, 3, 0}) {
+        FileUtils::writeFile(mSnapshotFile, content.left(length));
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        SExpression loaded;
+        EXPECT_EQ(0, snapshot.getEntriesCount()) << "length: " << length;
+        EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded)) << "length: " << length;
+    }
+}
+
+TEST_F(LibrarySnapshotTest, testCorruptFile)
+{
+    {
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        snapshot.insert(mElementFile, parse(mElementFile));
+        snapshot.save();
+    }
+
+    // corrupt the binary DOM tree at the end of the file (the index is still valid)
+    QByteArray content = FileUtils::readFile(mSnapshotFile);
+    for (int i = 1; i <= 8; ++i) {
+        content[content.length() - i] = static_cast<char>(0xFF);
+    }
+    FileUtils::writeFile(mSnapshotFile, content);
+    {
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        SExpression loaded;
+        EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded));
+    }
+
+    // garbage
+    FileUtils::writeFile(mSnapshotFile, QByteArray(1000, 'x'));
+    {
+        LibrarySnapshot snapshot(mSnapshotFile, mRootDir);
+        SExpression loaded;
+        EXPECT_EQ(0, snapshot.getEntriesCount());
+        EXPECT_FALSE(snapshot.tryLoad(mElementFile, loaded));
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace library
+} // namespace librepcb
@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/package.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LibraryTest : public ::testing::Test
+{
+    protected:
+        FilePath mTmpDir;
+        QScopedPointer<Library> mLibrary;
+
+        LibraryTest() {
+            mTmpDir = FilePath::getRandomTempPath();
+            mLibrary.reset(new Library(Uuid::createRandom(), Version("0.1"), "test",
+                                       "Test", "", ""));
+            mLibrary->saveTo(mTmpDir.getPathTo("Test.lplib"));
+        }
+
+        virtual ~LibraryTest() {
+            mLibrary.reset();
+            QDir(mTmpDir.toStr()).removeRecursively();
+        }
+
+        FilePath addElement(const QString& type, const QString& name) {
+            FilePath dir = mLibrary->getFilePath().getPathTo(type % "/" % name);
+            FileUtils::writeFile(dir.getPathTo(".librepcb-" % type), "0.1\n");
+            return dir;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LibraryTest, testSearchForAllElementsIsSorted)
+{
+    FilePath sym2 = addElement("sym", "b");
+    FilePath sym1 = addElement("sym", "a");
+    FilePath sym3 = addElement("sym", "c");
+    FilePath pkg1 = addElement("pkg", "a");
+
+    QHash<QString, QList<FilePath>> elements = mLibrary->searchForAllElements();
+    EXPECT_EQ(6, elements.count());
+    EXPECT_EQ((QList<FilePath>{sym1, sym2, sym3}), elements.value("sym"));
+    EXPECT_EQ((QList<FilePath>{pkg1}), elements.value("pkg"));
+    EXPECT_TRUE(elements.value("cmp").isEmpty());
+    EXPECT_TRUE(elements.contains("dev"));
+}
+
+TEST_F(LibraryTest, testSearchForAllElementsEqualsSearchForElements)
+{
+    addElement("sym", "b");
+    addElement("sym", "a");
+    addElement("pkg", "a");
+
+    QHash<QString, QList<FilePath>> elements = mLibrary->searchForAllElements();
+    EXPECT_EQ(mLibrary->searchForElements<Symbol>(), elements.value("sym"));
+    EXPECT_EQ(mLibrary->searchForElements<Package>(), elements.value("pkg"));
+}
+
+TEST_F(LibraryTest, testVersionFileMustBeAFile)
+{
+    FilePath valid = addElement("sym", "valid");
+    FilePath invalid = mLibrary->getFilePath().getPathTo("sym/invalid");
+    FileUtils::makePath(invalid.getPathTo(".librepcb-sym")); // directory, not a file
+    FilePath wrongType = mLibrary->getFilePath().getPathTo("sym/wrongtype");
+    FileUtils::writeFile(wrongType.getPathTo(".librepcb-pkg"), "0.1\n");
+
+    EXPECT_EQ((QList<FilePath>{valid}), mLibrary->searchForAllElements().value("sym"));
+    EXPECT_EQ((QList<FilePath>{valid}), mLibrary->searchForElements<Symbol>());
+    EXPECT_TRUE(invalid.isExistingDir()); // invalid elements must not be removed
+    EXPECT_TRUE(wrongType.isExistingDir());
+}
+
+TEST_F(LibraryTest, testNestedAndUnknownDirectoriesAreIgnored)
+{
+    FilePath valid = addElement("sym", "valid");
+    FileUtils::writeFile(valid.getPathTo("sub/.librepcb-sym"), "0.1\n");
+    FileUtils::writeFile(mLibrary->getFilePath().getPathTo("foo/bar/.librepcb-foo"),
+                         "0.1\n");
+    FileUtils::writeFile(mLibrary->getFilePath().getPathTo(".git/sym/.librepcb-sym"),
+                         "0.1\n");
+
+    QHash<QString, QList<FilePath>> elements = mLibrary->searchForAllElements();
+    EXPECT_EQ(6, elements.count());
+    EXPECT_EQ((QList<FilePath>{valid}), elements.value("sym"));
+}
+
+TEST_F(LibraryTest, testEmptyElementDirectoriesAreRemoved)
+{
+    FilePath valid = addElement("sym", "valid");
+    FilePath empty = mLibrary->getFilePath().getPathTo("sym/empty");
+    FileUtils::makePath(empty);
+
+    EXPECT_EQ((QList<FilePath>{valid}), mLibrary->searchForAllElements().value("sym"));
+    EXPECT_FALSE(empty.isExistingDir());
+    EXPECT_TRUE(valid.isExistingDir());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace library
+} // namespace librepcb
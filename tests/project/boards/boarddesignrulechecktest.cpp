@@ -0,0 +1,219 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/geometry/hole.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boarddesignrulecheck.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_via.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardDesignRuleCheckTest checks the design rule check of boards
+ *
+ * A new (empty) board with the default 160x100mm outline is added to the test project,
+ * then vias and holes are placed on it to provoke (or avoid) violations.
+ */
+class BoardDesignRuleCheckTest : public ::testing::Test
+{
+    protected:
+        QScopedPointer<Project> mProject;
+        Board* mBoard;
+        NetSignal* mNetA;
+        NetSignal* mNetB;
+
+        BoardDesignRuleCheckTest() : mBoard(nullptr), mNetA(nullptr), mNetB(nullptr) {
+            FilePath testDataDir(TEST_DATA_DIR "/project/boards/BoardPlaneFragmentsBuilderTest");
+            FilePath projectFp = testDataDir.getPathTo("test_project/test_project.lpp");
+            mProject.reset(new Project(projectFp, true));
+            mBoard = mProject->createBoard("DRC Test");
+            mProject->addBoard(*mBoard);
+            Circuit& circuit = mProject->getCircuit();
+            NetClass* netclass = new NetClass(circuit, "DRC_Test");
+            circuit.addNetClass(*netclass);
+            mNetA = new NetSignal(circuit, *netclass, "DRC_A", false);
+            circuit.addNetSignal(*mNetA);
+            mNetB = new NetSignal(circuit, *netclass, "DRC_B", false);
+            circuit.addNetSignal(*mNetB);
+        }
+
+        BI_Via* addVia(NetSignal& net, const Point& pos, const Length& size = Length(800000),
+                       const Length& drill = Length(400000)) {
+            BI_NetSegment* segment = new BI_NetSegment(*mBoard, net);
+            mBoard->addNetSegment(*segment);
+            BI_Via* via = new BI_Via(*segment, pos, BI_Via::Shape::Round, size, drill);
+            segment->addElements({via}, {}, {});
+            return via;
+        }
+
+        int getCopperLayerCount() const noexcept {
+            int count = 0;
+            foreach (const GraphicsLayer* layer, mBoard->getLayerStack().getAllLayers()) {
+                if (layer->isCopperLayer() && layer->isEnabled()) ++count;
+            }
+            return count;
+        }
+
+        int countMessages(const QString& text) const noexcept {
+            return mBoard->getDesignRuleCheck().getViolationMessages().filter(text).count();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardDesignRuleCheckTest, testEmptyBoard)
+{
+    EXPECT_EQ(0, mBoard->getDesignRuleCheck().execute());
+    EXPECT_TRUE(mBoard->getDesignRuleCheck().getViolationMessages().isEmpty());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testClearanceBetweenDifferentNets)
+{
+    // 0.1mm gap between the vias, but 0.2mm are required
+    addVia(*mNetA, Point(50000000, 50000000));
+    addVia(*mNetB, Point(50900000, 50000000));
+    // 0.4mm gap, no violation
+    addVia(*mNetA, Point(70000000, 50000000));
+    addVia(*mNetB, Point(71200000, 50000000));
+
+    BoardDesignRuleCheck& drc = mBoard->getDesignRuleCheck();
+    int count = drc.execute();
+    EXPECT_EQ(getCopperLayerCount(), count); // one violation per copper layer
+    EXPECT_EQ(count, countMessages("Clearance violation between Via of DRC_"));
+    EXPECT_EQ(count, drc.getViolationCount());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testNoClearanceViolationForSameNet)
+{
+    // overlapping vias of the same net are fine
+    addVia(*mNetA, Point(50000000, 50000000));
+    addVia(*mNetA, Point(50500000, 50000000));
+    addVia(*mNetB, Point(60000000, 50000000));
+    addVia(*mNetB, Point(60000000, 50900000));
+    EXPECT_EQ(0, mBoard->getDesignRuleCheck().execute());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testPairStraddlingTileBorderIsReportedOnce)
+{
+    // pairs of violating vias with different offsets, so some of them straddle the
+    // (1mm) tile borders horizontally, vertically or both
+    const int pairs = 20;
+    for (int i = 0; i < pairs; ++i) {
+        Point pos(20000000 + i * 2370000, 20000000 + i * 370000);
+        addVia(*mNetA, pos);
+        addVia(*mNetB, pos + Point(650000, 650000)); // 0.12mm gap
+    }
+
+    BoardDesignRuleCheck& drc = mBoard->getDesignRuleCheck();
+    BoardDesignRuleCheck::Settings settings = drc.getSettings();
+    settings.tileSize = Length(1000000);
+    drc.setSettings(settings);
+    EXPECT_EQ(pairs * getCopperLayerCount(), drc.execute());
+    QStringList smallTilesMessages = drc.getViolationMessages();
+
+    // must be exactly the same as when checking the whole board in a single tile
+    settings.tileSize = Length(1000000000);
+    drc.setSettings(settings);
+    EXPECT_EQ(pairs * getCopperLayerCount(), drc.execute());
+    EXPECT_EQ(smallTilesMessages, drc.getViolationMessages());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testOutlineClearance)
+{
+    // 0.1mm clearance to the left board edge, but 0.3mm are required
+    addVia(*mNetA, Point(500000, 50000000));
+    // 1.1mm clearance, no violation
+    addVia(*mNetB, Point(1500000, 60000000));
+    EXPECT_EQ(1, mBoard->getDesignRuleCheck().execute());
+    EXPECT_EQ(1, countMessages("Via of DRC_A is too close to the board outline"));
+}
+
+TEST_F(BoardDesignRuleCheckTest, testDrillAndAnnularRing)
+{
+    // drill 0.2mm < 0.3mm, annular ring 0.1mm < 0.15mm
+    addVia(*mNetA, Point(50000000, 50000000), Length(400000), Length(200000));
+    // drill 0.3mm, annular ring 0.15mm, no violation
+    addVia(*mNetB, Point(60000000, 50000000), Length(600000), Length(300000));
+    // drill 0.2mm < 0.3mm
+    mBoard->addHole(*new BI_Hole(*mBoard, Hole(Uuid::createRandom(),
+        Point(70000000, 50000000), Length(200000))));
+
+    EXPECT_EQ(3, mBoard->getDesignRuleCheck().execute());
+    EXPECT_EQ(1, countMessages("Drill of Via of DRC_A is too small"));
+    EXPECT_EQ(1, countMessages("Annular ring of Via of DRC_A is too small"));
+    EXPECT_EQ(1, countMessages("Drill of Hole is too small"));
+    EXPECT_EQ(0, countMessages("DRC_B"));
+
+    // the limits are taken from the settings
+    BoardDesignRuleCheck::Settings settings;
+    settings.minDrillDiameter = Length(100000);
+    settings.minAnnularRing = Length(50000);
+    mBoard->getDesignRuleCheck().setSettings(settings);
+    EXPECT_EQ(0, mBoard->getDesignRuleCheck().execute());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testResolvedViolationsAreRemoved)
+{
+    addVia(*mNetA, Point(50000000, 50000000));
+    BI_Via* via = addVia(*mNetB, Point(50900000, 50000000));
+    BoardDesignRuleCheck& drc = mBoard->getDesignRuleCheck();
+    EXPECT_EQ(getCopperLayerCount(), drc.execute());
+
+    // resolve the violation
+    via->setPosition(Point(52000000, 50000000));
+    EXPECT_EQ(0, drc.execute());
+    EXPECT_EQ(0, drc.getViolationCount());
+    EXPECT_TRUE(drc.getViolationMessages().isEmpty());
+
+    // provoke it again
+    via->setPosition(Point(50900000, 50000000));
+    EXPECT_EQ(getCopperLayerCount(), drc.execute());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
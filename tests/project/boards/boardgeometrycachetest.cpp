@@ -0,0 +1,71 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/project/boards/boardgeometrycache.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BoardGeometryCacheTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(BoardGeometryCacheTest, testTransformEqualsPathTransform)
+{
+    Path path = Path::centeredRect(Length(1000000), Length(500000));
+    path.addVertex(Point(300000, -700000));
+    ClipperLib::Path clipperPath = ClipperHelpers::convert(path, Length(5000));
+    Point pos(1234567, -7654321);
+    QList<Angle> angles = {Angle::deg0(), Angle::deg90(), Angle::deg180(),
+                           Angle::deg270(), -Angle::deg90(), Angle::deg45(),
+                           -Angle::deg45(), Angle(12345678), Angle(-12345678)};
+    foreach (const Angle& angle, angles) {
+        ClipperLib::Path expected = ClipperHelpers::convert(
+            path.rotated(angle).translated(pos), Length(5000));
+        ClipperLib::Path actual = BoardGeometryCache::transform(clipperPath, angle, pos);
+        EXPECT_EQ(expected, actual) << angle.toDeg();
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
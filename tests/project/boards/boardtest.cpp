@@ -0,0 +1,215 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/geometry/stroketext.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/boardfabricationoutputsettings.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/boards/items/bi_footprint.h>
+#include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/boards/items/bi_stroketext.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BoardTest : public ::testing::Test
+{
+    protected:
+        QScopedPointer<Project> mProject;
+        Board* mBoard;
+
+        BoardTest() : mBoard(nullptr) {
+            FilePath testDataDir(TEST_DATA_DIR "/project/boards/BoardPlaneFragmentsBuilderTest");
+            FilePath projectFp = testDataDir.getPathTo("test_project/test_project.lpp");
+            mProject.reset(new Project(projectFp, true));
+            mBoard = mProject->getBoards().first();
+        }
+
+        /**
+         * @brief Check the (cached) hit tests of an item against its grab area
+         *
+         * @param item      The item to check.
+         * @param hit       A scene position which must be within the grab area.
+         * @param miss      A scene position which must not be within the grab area.
+         */
+        static void checkHitTests(const BI_Base& item, const Point& hit,
+                                  const Point& miss) noexcept {
+            QPainterPath grabArea = item.getGrabAreaScenePx();
+            EXPECT_TRUE(grabArea.controlPointRect() == item.getGrabAreaBoundingRectScenePx());
+            EXPECT_TRUE(item.isGrabAreaAtScenePosPx(hit.toPxQPointF()));
+            EXPECT_FALSE(item.isGrabAreaAtScenePosPx(miss.toPxQPointF()));
+            for (int x = -5; x <= 25; ++x) {
+                for (int y = -5; y <= 25; ++y) {
+                    QPointF pos = Point(Length(x * 1000000), Length(y * 1000000)).toPxQPointF();
+                    QRectF rect(pos, QSizeF(Length(500000).toPx(), Length(500000).toPx()));
+                    EXPECT_EQ(grabArea.contains(pos), item.isGrabAreaAtScenePosPx(pos));
+                    EXPECT_EQ(grabArea.intersects(rect), item.isGrabAreaIntersectingScenePx(rect));
+                }
+            }
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardTest, testNoGraphicsItemsWhenHeadless)
+{
+    ASSERT_FALSE(mBoard->getDeviceInstances().isEmpty());
+    EXPECT_FALSE(mBoard->hasGraphicsItems());
+    EXPECT_TRUE(mBoard->getGraphicsScene().items().isEmpty());
+    foreach (const BI_Device* device, mBoard->getDeviceInstances()) {
+        const BI_Footprint& footprint = device->getFootprint();
+        EXPECT_EQ(nullptr, footprint.getGraphicsItem());
+        // grab areas are derived from the model without graphics items
+        EXPECT_EQ(footprint.getGrabAreaScenePx().controlPointRect(),
+                  footprint.getGrabAreaBoundingRectScenePx());
+    }
+
+    // modifying the board must not create graphics items either
+    foreach (BI_Device* device, mBoard->getDeviceInstances()) {
+        device->setPosition(device->getPosition() + Point(1000000, 0));
+        device->setRotation(device->getRotation() + Angle::deg90());
+        EXPECT_EQ(nullptr, device->getFootprint().getGraphicsItem());
+    }
+    mBoard->rebuildAllPlanes();
+    EXPECT_TRUE(mBoard->getGraphicsScene().items().isEmpty());
+}
+
+TEST_F(BoardTest, testCreateGraphicsItems)
+{
+    mBoard->createGraphicsItems();
+    EXPECT_TRUE(mBoard->hasGraphicsItems());
+    EXPECT_FALSE(mBoard->getGraphicsScene().items().isEmpty());
+    foreach (const BI_Device* device, mBoard->getDeviceInstances()) {
+        EXPECT_NE(nullptr, device->getFootprint().getGraphicsItem());
+    }
+
+    // items created afterwards must create their graphics items immediately
+    int count = mBoard->getGraphicsScene().items().count();
+    QScopedPointer<BI_Hole> hole(new BI_Hole(*mBoard, Hole(Uuid::createRandom(),
+        Point(0, 0), Length(1000000))));
+    mBoard->addHole(*hole);
+    EXPECT_GT(mBoard->getGraphicsScene().items().count(), count);
+    mBoard->removeHole(*hole);
+    EXPECT_EQ(count, mBoard->getGraphicsScene().items().count());
+}
+
+TEST_F(BoardTest, testGrabAreaHitTests)
+{
+    for (const char* layerName : {GraphicsLayer::sTopCopper, GraphicsLayer::sBoardDrillsNpth}) {
+        mBoard->getLayerStack().getLayer(layerName)->setVisible(true);
+    }
+    QScopedPointer<BI_Polygon> polygon(new BI_Polygon(*mBoard, Uuid::createRandom(),
+        GraphicsLayer::sTopCopper, Length(0), true, false,
+        Path::rect(Point(0, 0), Point(4000000, 4000000))));
+    QScopedPointer<BI_StrokeText> text(new BI_StrokeText(*mBoard, StrokeText(
+        Uuid::createRandom(), GraphicsLayer::sTopCopper, "X", Point(10000000, 0),
+        Angle::deg0(), Length(1000000), Length(200000), StrokeTextSpacing(),
+        StrokeTextSpacing(), Alignment(HAlign::center(), VAlign::center()), false, true)));
+    QScopedPointer<BI_Hole> hole(new BI_Hole(*mBoard, Hole(Uuid::createRandom(),
+        Point(20000000, 0), Length(1000000))));
+    mBoard->addPolygon(*polygon);
+    mBoard->addStrokeText(*text);
+    mBoard->addHole(*hole);
+
+    // both without and with graphics items, the hit tests must follow all modifications
+    for (bool graphicsItems : {false, true}) {
+        if (graphicsItems) {
+            mBoard->createGraphicsItems();
+        }
+        polygon->getPolygon().setPath(Path::rect(Point(0, 0), Point(4000000, 4000000)));
+        text->getText().setPosition(Point(10000000, 0));
+        hole->getHole().setPosition(Point(20000000, 0));
+        checkHitTests(*polygon, Point(2000000, 2000000), Point(2000000, 10000000));
+        checkHitTests(*text, Point(10000000, 0), Point(10000000, 10000000));
+        checkHitTests(*hole, Point(20000000, 0), Point(20000000, 10000000));
+
+        polygon->getPolygon().setPath(Path::rect(Point(0, 10000000), Point(4000000, 14000000)));
+        text->getText().setPosition(Point(10000000, 10000000));
+        hole->getHole().setPosition(Point(20000000, 10000000));
+        checkHitTests(*polygon, Point(2000000, 12000000), Point(2000000, 2000000));
+        checkHitTests(*text, Point(10000000, 10000000), Point(10000000, 0));
+        checkHitTests(*hole, Point(20000000, 10000000), Point(20000000, 0));
+    }
+
+    mBoard->removeHole(*hole);
+    mBoard->removeStrokeText(*text);
+    mBoard->removePolygon(*polygon);
+}
+
+TEST_F(BoardTest, testPanelizationIsValidated)
+{
+    BoardGerberExport grbExport(*mBoard);
+    EXPECT_NO_THROW(grbExport.setPanelization(1, 1, Point(0, 0)));
+    EXPECT_NO_THROW(grbExport.setPanelization(2, 3, Point(50000000, 30000000)));
+    EXPECT_NO_THROW(grbExport.setPanelization(2, 1, Point(50000000, 0)));
+    EXPECT_THROW(grbExport.setPanelization(0, 1, Point(50000000, 30000000)), Exception);
+    EXPECT_THROW(grbExport.setPanelization(1, -1, Point(50000000, 30000000)), Exception);
+    EXPECT_THROW(grbExport.setPanelization(2, 1, Point(0, 30000000)), Exception);
+    EXPECT_THROW(grbExport.setPanelization(1, 2, Point(50000000, 0)), Exception);
+    EXPECT_THROW(grbExport.setPanelization(2, 2, Point(-50000000, 30000000)), Exception);
+}
+
+TEST_F(BoardTest, testPanelizationSettings)
+{
+    BoardFabricationOutputSettings settings;
+    EXPECT_EQ(1, settings.getPanelColumns());
+    EXPECT_EQ(1, settings.getPanelRows());
+    settings.setPanelColumns(4);
+    settings.setPanelRows(2);
+    settings.setPanelPitch(Point(50000000, 30000000));
+    BoardFabricationOutputSettings loaded(settings.serializeToDomElement("settings"));
+    EXPECT_EQ(settings, loaded);
+    EXPECT_EQ(4, loaded.getPanelColumns());
+    EXPECT_EQ(Point(50000000, 30000000), loaded.getPanelPitch());
+
+    // the export uses the panelization of the settings, so it must be validated too
+    settings.setPanelRows(0);
+    mBoard->getFabricationOutputSettings() = settings;
+    EXPECT_THROW(BoardGerberExport(*mBoard).exportAllLayers(), Exception);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,194 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief The BI_NetSegmentTest checks (and benchmarks) large board net segments
+ *
+ * A new project with an empty board and a single net signal is created in a temporary
+ * directory. Then a net segment with a very long trace (e.g. a ground net) is generated,
+ * which must be loaded and modified in linear time of the number of elements.
+ */
+class BI_NetSegmentTest : public ::testing::Test
+{
+    protected:
+        FilePath mProjectDir;
+        QScopedPointer<Project> mProject;
+        Board* mBoard;
+        NetSignal* mNetSignal;
+        QList<Uuid> mNetPointUuids;
+        QList<Uuid> mNetLineUuids;
+
+        BI_NetSegmentTest() : mBoard(nullptr), mNetSignal(nullptr) {
+            mProjectDir = FilePath::getRandomTempPath().getPathTo("test project dir");
+            mProject.reset(Project::create(mProjectDir.getPathTo("test project.lpp")));
+            mBoard = mProject->createBoard("Test");
+            mProject->addBoard(*mBoard);
+            Circuit& circuit = mProject->getCircuit();
+            NetClass* netclass = new NetClass(circuit, "Test");
+            circuit.addNetClass(*netclass);
+            mNetSignal = new NetSignal(circuit, *netclass, "GND", false);
+            circuit.addNetSignal(*mNetSignal);
+        }
+
+        virtual ~BI_NetSegmentTest() {
+            mProject.reset();
+            QDir(mProjectDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        /**
+         * @brief Generate a net segment containing a chain of netpoints and netlines
+         *
+         * @param netPointCount     Number of netpoints (the number of netlines is one less).
+         *
+         * @return The serialized net segment
+         */
+        SExpression generateSegment(int netPointCount) {
+            SExpression node = SExpression::createList("netsegment");
+            node.appendToken(Uuid::createRandom());
+            node.appendTokenChild("net", mNetSignal->getUuid(), true);
+            for (int i = 0; i < netPointCount; ++i) {
+                mNetPointUuids.append(Uuid::createRandom());
+                SExpression child = SExpression::createList("netpoint");
+                child.appendToken(mNetPointUuids.last());
+                child.appendTokenChild("layer", QString(GraphicsLayer::sTopCopper), false);
+                child.appendChild(Point(Length(i * 100000), Length(0)).serializeToDomElement("pos"), true);
+                node.appendChild(child, true);
+            }
+            for (int i = 1; i < netPointCount; ++i) {
+                mNetLineUuids.append(Uuid::createRandom());
+                SExpression child = SExpression::createList("netline");
+                child.appendToken(mNetLineUuids.last());
+                child.appendTokenChild("width", Length(200000), false);
+                child.appendTokenChild("p1", mNetPointUuids.at(i - 1), true);
+                child.appendTokenChild("p2", mNetPointUuids.at(i), true);
+                node.appendChild(child, true);
+            }
+            return node;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BI_NetSegmentTest, testLoadLargeSegment)
+{
+    // generate a chain of 10'000 netpoints and 9'999 netlines (19'999 elements in total)
+    const int netPointCount = 10000;
+    SExpression node = generateSegment(netPointCount);
+
+    // load the net segment
+    QElapsedTimer timer;
+    timer.start();
+    BI_NetSegment* segment = new BI_NetSegment(*mBoard, node);
+    RecordProperty("LoadTimeMs", static_cast<int>(timer.elapsed()));
+    mBoard->addNetSegment(*segment); // takes ownership
+
+    // check the loaded segment
+    EXPECT_EQ(mNetSignal, &segment->getNetSignal());
+    ASSERT_EQ(netPointCount, segment->getNetPoints().count());
+    ASSERT_EQ(netPointCount - 1, segment->getNetLines().count());
+    EXPECT_EQ(0, segment->getVias().count());
+    for (int i = 0; i < netPointCount; ++i) {
+        BI_NetPoint* netpoint = segment->getNetPointByUuid(mNetPointUuids.at(i));
+        ASSERT_NE(nullptr, netpoint);
+        EXPECT_EQ(Point(Length(i * 100000), Length(0)), netpoint->getPosition());
+    }
+    for (int i = 0; i < netPointCount - 1; ++i) {
+        BI_NetLine* netline = segment->getNetLineByUuid(mNetLineUuids.at(i));
+        ASSERT_NE(nullptr, netline);
+        EXPECT_EQ(mNetPointUuids.at(i), netline->getStartPoint().getUuid());
+        EXPECT_EQ(mNetPointUuids.at(i + 1), netline->getEndPoint().getUuid());
+    }
+    EXPECT_EQ(nullptr, segment->getNetPointByUuid(Uuid::createRandom()));
+    EXPECT_EQ(nullptr, segment->getNetLineByUuid(Uuid::createRandom()));
+}
+
+TEST_F(BI_NetSegmentTest, testRemoveManyElements)
+{
+    const int netPointCount = 10000;
+    BI_NetSegment* segment = new BI_NetSegment(*mBoard, generateSegment(netPointCount));
+    mBoard->addNetSegment(*segment); // takes ownership
+    QList<BI_NetPoint*> netpoints = segment->getNetPoints();
+    QList<BI_NetLine*> netlines = segment->getNetLines();
+
+    // removing a netpoint in the middle of the trace must fail and restore all elements
+    const int middle = netPointCount / 2;
+    EXPECT_THROW(segment->removeElements({}, {netpoints.at(middle)},
+        {netlines.at(middle - 1), netlines.at(middle)}), Exception);
+    EXPECT_EQ(netpoints, segment->getNetPoints());
+    EXPECT_EQ(netlines, segment->getNetLines());
+    EXPECT_EQ(netpoints.at(middle), segment->getNetPointByUuid(netpoints.at(middle)->getUuid()));
+    EXPECT_EQ(netlines.at(middle), segment->getNetLineByUuid(netlines.at(middle)->getUuid()));
+
+    // remove the second half of the trace in one step
+    QList<BI_NetPoint*> removedNetPoints = netpoints.mid(middle);
+    QList<BI_NetLine*> removedNetLines = netlines.mid(middle - 1);
+    QElapsedTimer timer;
+    timer.start();
+    segment->removeElements({}, removedNetPoints, removedNetLines);
+    RecordProperty("RemoveTimeMs", static_cast<int>(timer.elapsed()));
+
+    // the remaining elements must keep their order
+    EXPECT_EQ(netpoints.mid(0, middle), segment->getNetPoints());
+    EXPECT_EQ(netlines.mid(0, middle - 1), segment->getNetLines());
+    foreach (const BI_NetPoint* netpoint, removedNetPoints) {
+        EXPECT_EQ(nullptr, segment->getNetPointByUuid(netpoint->getUuid()));
+    }
+    foreach (const BI_NetLine* netline, removedNetLines) {
+        EXPECT_EQ(nullptr, segment->getNetLineByUuid(netline->getUuid()));
+    }
+    qDeleteAll(removedNetLines);
+    qDeleteAll(removedNetPoints);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
@@ -62,10 +62,15 @@ PRE_TARGETDEPS += \
 SOURCES += \
     common/applicationtest.cpp \
     common/attributes/attributesubstitutortest.cpp \
+    common/cam/excellongeneratortest.cpp \
+    common/cam/gerberaperturelisttest.cpp \
+    common/cam/gerbergeneratortest.cpp \
     common/directorylocktest.cpp \
     common/filedownloadtest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
+    common/fileio/sexpressiontest.cpp \
     common/filepathtest.cpp \
+    common/geometry/stroketexttest.cpp \
     common/networkrequesttest.cpp \
     common/pointtest.cpp \
     common/ratiotest.cpp \
@@ -73,15 +78,27 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/utils/clipperhelperstest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
+    eagleimport/batchconvertertest.cpp \
+    eagleimport/converterdbtest.cpp \
     eagleimport/deviceconvertertest.cpp \
     eagleimport/devicesetconvertertest.cpp \
     eagleimport/packageconvertertest.cpp \
     eagleimport/symbolconvertertest.cpp \
+    library/librarysnapshottest.cpp \
+    library/librarytest.cpp \
     main.cpp \
+    project/boards/boarddesignrulechecktest.cpp \
+    project/boards/boardgeometrycachetest.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
+    project/boards/boardtest.cpp \
+    project/boards/items/bi_netsegmenttest.cpp \
     project/projecttest.cpp \
+    workspace/library/workspacelibrarydbtest.cpp \
+    workspace/library/workspacelibraryscannertest.cpp \
+    workspace/library/workspacelibrarywatchertest.cpp \
     workspace/workspacetest.cpp \
 
 HEADERS += \
@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class WorkspaceLibraryDbTest : public ::testing::Test
+{
+    protected:
+        FilePath mWsDir;
+        FilePath mLibDir;
+        QScopedPointer<Workspace> mWorkspace;
+
+        WorkspaceLibraryDbTest() {
+            mWsDir = FilePath::getRandomTempPath().getPathTo("test workspace dir");
+            Workspace::createNewWorkspace(mWsDir);
+            FilePath librariesPath = mWsDir.getPathTo("v" %
+                qApp->getFileFormatVersion().toStr()).getPathTo("libraries");
+            mLibDir = librariesPath.getPathTo("local/Test.lplib");
+            Library lib(Uuid::createRandom(), Version("0.1"), "test", "Test", "", "");
+            lib.saveTo(mLibDir);
+            mWorkspace.reset(new Workspace(mWsDir));
+        }
+
+        virtual ~WorkspaceLibraryDbTest() {
+            mWorkspace.reset();
+            QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        FilePath addSymbol(const Uuid& uuid) {
+            Symbol symbol(uuid, Version("0.1"), "test", "Test Symbol", "", "");
+            symbol.saveIntoParentDirectory(mLibDir.getPathTo("sym"));
+            return mLibDir.getPathTo("sym").getPathTo(uuid.toStr());
+        }
+
+        bool rescanAndWait() {
+            WorkspaceLibraryDb& db = mWorkspace->getLibraryDb();
+            QEventLoop loop;
+            bool success = false;
+            QMetaObject::Connection c1 = QObject::connect(
+                &db, &WorkspaceLibraryDb::scanSucceeded,
+                [&](){success = true; loop.quit();});
+            QMetaObject::Connection c2 = QObject::connect(
+                &db, &WorkspaceLibraryDb::scanFailed, [&](){loop.quit();});
+            QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+            db.startLibraryRescan();
+            loop.exec();
+            QObject::disconnect(c1);
+            QObject::disconnect(c2);
+            return success;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testRescanInvalidatesLookups)
+{
+    Uuid uuid = Uuid::createRandom();
+    FilePath symDir = addSymbol(uuid);
+    ASSERT_TRUE(rescanAndWait());
+    EXPECT_EQ(symDir, mWorkspace->getLibraryDb().getLatestSymbol(uuid)); // now cached
+
+    FileUtils::removeDirRecursively(symDir);
+    ASSERT_TRUE(rescanAndWait());
+    EXPECT_FALSE(mWorkspace->getLibraryDb().getLatestSymbol(uuid).isValid());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testLookupsDuringRescanAreNotCached)
+{
+    Uuid uuid = Uuid::createRandom();
+    FilePath symDir = addSymbol(uuid);
+    ASSERT_TRUE(rescanAndWait());
+    FileUtils::removeDirRecursively(symDir);
+
+    // a lookup while the rescan is running must not survive the end of the rescan
+    WorkspaceLibraryDb& db = mWorkspace->getLibraryDb();
+    int lookups = 0;
+    QMetaObject::Connection c = QObject::connect(&db, &WorkspaceLibraryDb::scanStarted,
+        [&](){db.getLatestSymbol(uuid); ++lookups;});
+    ASSERT_TRUE(rescanAndWait());
+    QObject::disconnect(c);
+    EXPECT_GE(lookups, 1);
+    EXPECT_FALSE(db.getLatestSymbol(uuid).isValid());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace workspace
+} // namespace librepcb
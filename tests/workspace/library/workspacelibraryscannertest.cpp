@@ -0,0 +1,158 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibraryscanner.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class WorkspaceLibraryScannerTest : public ::testing::Test
+{
+    protected:
+        FilePath mWsDir;
+        FilePath mLibrariesPath;
+        FilePath mLibDir;
+        QScopedPointer<Workspace> mWorkspace;
+
+        WorkspaceLibraryScannerTest() {
+            mWsDir = FilePath::getRandomTempPath().getPathTo("test workspace dir");
+            Workspace::createNewWorkspace(mWsDir);
+            mLibrariesPath = mWsDir.getPathTo("v" %
+                qApp->getFileFormatVersion().toStr()).getPathTo("libraries");
+            mLibDir = addLibrary("Test.lplib");
+            mWorkspace.reset(new Workspace(mWsDir));
+        }
+
+        virtual ~WorkspaceLibraryScannerTest() {
+            mWorkspace.reset();
+            QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        FilePath addLibrary(const QString& name) {
+            FilePath dir = mLibrariesPath.getPathTo("local").getPathTo(name);
+            Library lib(Uuid::createRandom(), Version("0.1"), "test", "Test", "", "");
+            lib.saveTo(dir);
+            return dir;
+        }
+
+        FilePath addSymbol(const Uuid& uuid) {
+            Symbol symbol(uuid, Version("0.1"), "test", "Test Symbol", "", "");
+            symbol.saveIntoParentDirectory(mLibDir.getPathTo("sym"));
+            return mLibDir.getPathTo("sym").getPathTo(uuid.toStr());
+        }
+
+        struct ScanResult {
+            int started;
+            int succeeded;
+            int failed;
+        };
+
+        // start a scan and wait until it has finished
+        template <typename Func>
+        ScanResult scan(WorkspaceLibraryScanner& scanner, Func startScan) {
+            ScanResult result = {0, 0, 0};
+            QEventLoop loop;
+            // the signals are emitted in the worker thread, thus they are queued to
+            // the thread of the event loop
+            QObject::connect(&scanner, &WorkspaceLibraryScanner::started,
+                             &loop, [&](){++result.started;});
+            QObject::connect(&scanner, &WorkspaceLibraryScanner::succeeded,
+                             &loop, [&](){++result.succeeded; loop.quit();});
+            QObject::connect(&scanner, &WorkspaceLibraryScanner::failed,
+                             &loop, [&](){++result.failed; loop.quit();});
+            QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+            startScan();
+            loop.exec();
+            return result;
+        }
+
+        FilePath lookupSymbol(const Uuid& uuid) {
+            mWorkspace->getLibraryDb().clearCache();
+            return mWorkspace->getLibraryDb().getLatestSymbol(uuid);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(WorkspaceLibraryScannerTest, testFullScan)
+{
+    Uuid uuid = Uuid::createRandom();
+    FilePath symDir = addSymbol(uuid);
+    WorkspaceLibraryScanner scanner(*mWorkspace);
+    ScanResult result = scan(scanner, [&](){scanner.startFullScan();});
+    EXPECT_EQ(1, result.started);
+    EXPECT_EQ(1, result.succeeded);
+    EXPECT_EQ(0, result.failed);
+    EXPECT_EQ(symDir, lookupSymbol(uuid));
+}
+
+TEST_F(WorkspaceLibraryScannerTest, testElementsScanAddsAndRemovesElements)
+{
+    WorkspaceLibraryScanner scanner(*mWorkspace);
+    ASSERT_EQ(1, scan(scanner, [&](){scanner.startFullScan();}).succeeded);
+
+    // incremental scan of a new element
+    Uuid uuid = Uuid::createRandom();
+    FilePath symDir = addSymbol(uuid);
+    EXPECT_FALSE(lookupSymbol(uuid).isValid());
+    ScanResult result = scan(scanner, [&](){scanner.startElementsScan({symDir});});
+    EXPECT_EQ(1, result.started); // incremental scans must emit started() as well
+    EXPECT_EQ(1, result.succeeded);
+    EXPECT_EQ(0, result.failed);
+    EXPECT_EQ(symDir, lookupSymbol(uuid));
+
+    // incremental scan of a removed element
+    FileUtils::removeDirRecursively(symDir);
+    result = scan(scanner, [&](){scanner.startElementsScan({symDir});});
+    EXPECT_EQ(1, result.started);
+    EXPECT_EQ(1, result.succeeded);
+    EXPECT_EQ(0, result.failed);
+    EXPECT_FALSE(lookupSymbol(uuid).isValid());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace workspace
+} // namespace librepcb
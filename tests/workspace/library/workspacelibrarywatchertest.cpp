@@ -0,0 +1,186 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarywatcher.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class WorkspaceLibraryWatcherTest : public ::testing::Test
+{
+    protected:
+        FilePath mWsDir;
+        FilePath mLibrariesPath;
+        FilePath mLibDir;
+        QScopedPointer<Workspace> mWorkspace;
+
+        WorkspaceLibraryWatcherTest() {
+            mWsDir = FilePath::getRandomTempPath().getPathTo("test workspace dir");
+            Workspace::createNewWorkspace(mWsDir);
+            mLibrariesPath = mWsDir.getPathTo("v" %
+                qApp->getFileFormatVersion().toStr()).getPathTo("libraries");
+            mLibDir = addLibrary("Test.lplib");
+            mWorkspace.reset(new Workspace(mWsDir));
+        }
+
+        virtual ~WorkspaceLibraryWatcherTest() {
+            mWorkspace.reset();
+            QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        FilePath addLibrary(const QString& name) {
+            FilePath dir = mLibrariesPath.getPathTo("local").getPathTo(name);
+            Library lib(Uuid::createRandom(), Version("0.1"), "test", "Test", "", "");
+            lib.saveTo(dir);
+            return dir;
+        }
+
+        FilePath addSymbol(const Uuid& uuid) {
+            Symbol symbol(uuid, Version("0.1"), "test", "Test Symbol", "", "");
+            symbol.saveIntoParentDirectory(mLibDir.getPathTo("sym"));
+            return mLibDir.getPathTo("sym").getPathTo(uuid.toStr());
+        }
+
+        QScopedPointer<WorkspaceLibraryWatcher> mWatcher;
+
+        void startWatcher() {
+            mWatcher.reset(new WorkspaceLibraryWatcher(*mWorkspace));
+            mWatcher->setDebounceInterval(50);
+            mWatcher->setEnabled(true);
+        }
+
+        // wait for the first elementsChanged() or librariesChanged() signal
+        void waitForChanges(QSet<FilePath>* elementDirs, QSet<FilePath>* libraryDirs,
+                            int timeout = 5000) {
+            QEventLoop loop;
+            QMetaObject::Connection c1 = QObject::connect(
+                mWatcher.data(), &WorkspaceLibraryWatcher::elementsChanged,
+                [&](const QSet<FilePath>& dirs){elementDirs->unite(dirs); loop.quit();});
+            QMetaObject::Connection c2 = QObject::connect(
+                mWatcher.data(), &WorkspaceLibraryWatcher::librariesChanged,
+                [&](const QSet<FilePath>& dirs){libraryDirs->unite(dirs); loop.quit();});
+            QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+            loop.exec();
+            // both signals are emitted at the same time, so process the second one too
+            QCoreApplication::processEvents();
+            QObject::disconnect(c1);
+            QObject::disconnect(c2);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(WorkspaceLibraryWatcherTest, testAddedElementIsReported)
+{
+    startWatcher();
+    FilePath symDir = addSymbol(Uuid::createRandom());
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs);
+    EXPECT_EQ(QSet<FilePath>{symDir}, elementDirs);
+    EXPECT_TRUE(libraryDirs.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryWatcherTest, testReplacedElementFileIsReported)
+{
+    FilePath symDir = addSymbol(Uuid::createRandom());
+    startWatcher();
+
+    // files are replaced (not modified in place) by "git pull" and FileUtils::writeFile()
+    QStringList files = QDir(symDir.toStr()).entryList(QDir::Files | QDir::Hidden);
+    ASSERT_FALSE(files.isEmpty());
+    FilePath file = symDir.getPathTo(files.first());
+    FileUtils::writeFile(file, FileUtils::readFile(file));
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs);
+    EXPECT_EQ(QSet<FilePath>{symDir}, elementDirs);
+    EXPECT_TRUE(libraryDirs.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryWatcherTest, testRemovedElementIsReported)
+{
+    FilePath symDir = addSymbol(Uuid::createRandom());
+    startWatcher();
+    FileUtils::removeDirRecursively(symDir);
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs);
+    EXPECT_EQ(QSet<FilePath>{symDir}, elementDirs);
+    EXPECT_TRUE(libraryDirs.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryWatcherTest, testAddedLibraryIsReported)
+{
+    startWatcher();
+    FilePath libDir = addLibrary("New.lplib");
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs);
+    EXPECT_EQ(QSet<FilePath>{libDir}, libraryDirs);
+    EXPECT_TRUE(elementDirs.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryWatcherTest, testRemovedLibraryIsReported)
+{
+    FilePath libDir = addLibrary("New.lplib");
+    startWatcher();
+    FileUtils::removeDirRecursively(libDir);
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs);
+    EXPECT_EQ(QSet<FilePath>{libDir}, libraryDirs);
+    EXPECT_TRUE(elementDirs.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryWatcherTest, testDisabledWatcherReportsNothing)
+{
+    startWatcher();
+    mWatcher->setEnabled(false);
+    addSymbol(Uuid::createRandom());
+    QSet<FilePath> elementDirs, libraryDirs;
+    waitForChanges(&elementDirs, &libraryDirs, 500);
+    EXPECT_TRUE(elementDirs.isEmpty());
+    EXPECT_TRUE(libraryDirs.isEmpty());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace workspace
+} // namespace librepcb